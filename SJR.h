@@ -1,11 +1,39 @@
 #include <vector>
-#include <map>
+#include <new>
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <stdexcept>
 
 #include <fstream>
 
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <limits>
 #include <cstring>
 #include <cmath>
 #include <type_traits>
+#include <initializer_list>
+#include <utility>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 
 class SJR
@@ -21,9 +49,76 @@ class SJR
             STRING = 3,
             ARRAY = 4,
             OBJECT = 5,
+            INT64 = 6,
+            UINT64 = 7,
+            DOUBLE = 8,
+        };
+
+        class PaddedBuffer;
+        class Document;
+        class PushParser;
+        class LineReader;
+        class Tape;
+        class TapeView;
+        class LazyDocument;
+        class LazyView;
+        class Projection;
+
+        struct ParseOptions
+        {
+            //  Deepest nesting of arrays and objects accepted before the
+            //  parse fails. Larger values are lowered to depthLimit: copying,
+            //  saving and destroying a tree recurse once per level, and 4096
+            //  levels fit in a 512 KB thread stack.
+            //
+            size_t maxDepth = 1024;
+            static constexpr size_t depthLimit = 4096;
+
+            //  Paths of the members to build; everything else is skipped.
+            //  Must outlive the parse. Not used by PushParser.
+            //
+            const Projection* projection = nullptr;
+
+            //  Store each distinct key once and point every member with that
+            //  key at it. A tree built by SJR::parse then keeps one shared
+            //  copy of each key instead of one per member. A Document's keys
+            //  are already views into its buffer, so there it only pays off
+            //  for lookups with Document::key(), at a hash probe per key.
+            //
+            bool internKeys = false;
         };
 
+        SJR() = default;
+        SJR(const SJR& other);
+        SJR(SJR&& other) noexcept;
+        ~SJR();
+
+        SJR& operator= (const SJR& other);
+        SJR& operator= (SJR&& other) noexcept;
+
         void load(std::string_view filename);
+        void load(std::string_view filename, const ParseOptions& options);
+
+        void parse(std::string_view json);
+        void parse(std::string_view json, const ParseOptions& options);
+        void parse(PaddedBuffer& buffer);
+        void parse(PaddedBuffer& buffer, const ParseOptions& options);
+
+        //  Parses without building a tree. handler is called for every event:
+        //  startObject(), startArray(), key(std::string_view),
+        //  string(std::string_view), integer(int64_t), real(double),
+        //  boolean(bool) and end() for either container; integers above
+        //  INT64_MAX go to unsignedInteger(uint64_t). A view is valid only
+        //  during its call.
+        //
+        template<class Handler>
+        static void parseEvents(std::string_view json, Handler& handler);
+        template<class Handler>
+        static void parseEvents(std::string_view json, Handler& handler, const ParseOptions& options);
+        template<class Handler>
+        static void parseEvents(PaddedBuffer& buffer, Handler& handler);
+        template<class Handler>
+        static void parseEvents(PaddedBuffer& buffer, Handler& handler, const ParseOptions& options);
 
         [[nodiscard]]
         bool save(std::string_view filename);
@@ -45,17 +140,236 @@ class SJR
         SJR& operator[] (std::string_view nodeName);
         SJR& operator[] (size_t index);
 
+        //  Lookups that never change the tree, so any number of threads may
+        //  read one tree at once. A missing node makes find return nullptr,
+        //  at throw std::out_of_range and tryGet return no value; so does a
+        //  node of a type T cannot be read from.
+        //
+        [[nodiscard]]
+        const SJR* find(std::string_view nodeName) const;
+        [[nodiscard]]
+        const SJR* find(size_t index) const;
+        [[nodiscard]]
+        const SJR& at(std::string_view nodeName) const;
+        [[nodiscard]]
+        const SJR& at(size_t index) const;
+        [[nodiscard]]
+        bool contains(std::string_view nodeName) const;
+        template<class T>
+        [[nodiscard]]
+        std::optional<T> tryGet(std::string_view nodeName) const;
+
     private:
 
-        std::map<std::string, SJR> mapJson;
-        std::vector<SJR> vectorJson;
+        //  Key and value of one object child, stored contiguously per object.
+        //
+        struct Member;
+
+        //  Where the key of a member lives: in a block of its own, in memory
+        //  owned by someone else, or in a block shared by every member with
+        //  that key, which counts its references.
+        //
+        enum class KeyStorage : int
+        {
+            OWNED = 0,
+            BORROWED = 1,
+            SHARED = 2,
+        };
+
+        //  Bump allocator that owns every node and string of a Document.
+        //
+        class Arena;
+
+        //  Distinct member names of a parse, each kept once.
+        //
+        class KeyTable;
 
-        std::string value;
+        //  Scalars are stored inline; strings and children live in a single
+        //  separately allocated block of capacity bytes or children.
+        //
+        union
+        {
+            bool boolValue;
+            int64_t intValue = 0;
+            uint64_t uintValue;
+            double doubleValue;
+            char* stringData;
+            SJR* arrayData;
+            Member* objectData;
+        };
+
+        uint32_t count = 0;
+        uint32_t capacity = 0;
         Type type = Type::OBJECT;
 
+        //  The block belongs to an Arena, and so does everything below it.
+        bool borrowed = false;
+
+        //  The members of an object are indexed after them in the block.
+        bool indexed = false;
+
+        //  The block was moved out of an Arena, but blocks below it may
+        //  still belong to one.
+        bool fromArena = false;
+
+        void release();
+        void steal(SJR& other) noexcept;
+
+        void assignString(const char* data, size_t length, Arena* arena = nullptr);
+        void borrowString(const char* data, size_t length);
+        void relocateChildren(uint32_t newCapacity, Arena* arena);
+        void reserveChildren(uint32_t newCapacity, Arena* arena = nullptr);
+        void detach();
+        void resizeArray(uint32_t newCount);
+        SJR& emplaceChild(Arena* arena = nullptr);
+
+        [[nodiscard]]
+        SJR* findMember(std::string_view key) const;
+        SJR& placeMember(std::string_view key, Arena* arena = nullptr, KeyStorage storage = KeyStorage::OWNED);
+        SJR& emplaceMember(std::string_view key, Arena* arena = nullptr, KeyStorage storage = KeyStorage::OWNED);
+        SJR& appendMember(std::string_view key, Arena* arena, KeyStorage storage);
+
+        [[nodiscard]]
+        static char* shareKey(std::string_view key);
+        static void retainKey(char* key);
+        static void releaseKey(char* key);
+
+        //  Objects able to hold more members than this keep an open-addressing
+        //  index of them after the members, in the same block; smaller ones
+        //  are scanned. The index is laid out as in SwissTable: one control
+        //  byte per slot, either emptyControl or the low seven bits of the
+        //  key's hash, probed sixteen at a time, and the member positions.
+        //
+        static constexpr uint32_t indexThreshold = 16;
+        static constexpr uint32_t groupSize = 16;
+        static constexpr uint8_t emptyControl = 0x80;
+
+        [[nodiscard]]
+        static bool matchKey(const Member& member, std::string_view key);
+        [[nodiscard]]
+        static uint64_t hashKey(std::string_view key);
+        [[nodiscard]]
+        static uint32_t indexSize(uint32_t capacity);
+        [[nodiscard]]
+        static uint32_t matchControl(const uint8_t* group, uint8_t control);
+        [[nodiscard]]
+        uint32_t* indexSlots() const;
+        [[nodiscard]]
+        uint8_t* indexControl() const;
+        [[nodiscard]]
+        uint32_t probeIndex(std::string_view key, uint64_t hash, bool& found) const;
+        void indexMember(uint32_t position);
+        void buildIndex();
+
+        //  Zero bytes kept after the end of every parsed buffer, so that vector
+        //  loads near the end never leave the allocation.
+        //
+        static constexpr size_t paddingSize = 64;
+
+
+        //  Class of a byte as seen by the parser, looked up in charClasses.
+        //
+        enum class CharClass : unsigned char
+        {
+            OTHER = 0,
+            WHITESPACE = 1,
+            QUOTE = 2,
+            DIGIT = 3,
+            SIGN = 4,
+            LITERAL = 5,
+            ARRAY_BEGIN = 6,
+            OBJECT_BEGIN = 7,
+            ARRAY_END = 8,
+            OBJECT_END = 9,
+            COLON = 10,
+            COMMA = 11,
+            BACKSLASH = 12,
+        };
+
+        static const std::array<CharClass, 256> charClasses;
+
+        static constexpr std::array<CharClass, 256> makeCharClasses();
+
+        //  Byte produced by each single-character escape sequence, zero where
+        //  the sequence is invalid or, for \u, longer.
+        //
+        static const std::array<char, 256> escapeChars;
+
+        static constexpr std::array<char, 256> makeEscapeChars();
+
+        [[nodiscard]]
+        static CharClass classify(char c);
+        [[nodiscard]]
+        static bool isWhiteSpace(char c);
+        [[nodiscard]]
+        static bool isDigit(char c);
+
+        [[nodiscard]]
+        static bool isOperator(char c);
+
         static void writeTabs(std::ofstream& file, size_t count);
+        static void writeEscaped(std::ofstream& file, const char* data, size_t length);
         static void skipWhiteSpace(char*&file);
 
+        //  Bit operations that compilers only offer as extensions, each with
+        //  a plain fallback.
+        //
+        [[nodiscard]]
+        static int countTrailingZeros(uint64_t bits);
+        [[nodiscard]]
+        static int countLeadingZeros(uint64_t bits);
+        [[nodiscard]]
+        static uint64_t multiplyHigh(uint64_t left, uint64_t right, uint64_t& low);
+        [[nodiscard]]
+        static bool appendDigit(uint64_t& value, uint64_t digit);
+
+        [[nodiscard]]
+        static char* findStringStop(char* file);
+        [[nodiscard]]
+        static bool parseHex(const char* file, uint32_t& value);
+        [[nodiscard]]
+        static char* decodeEscape(char* file, char*& out);
+        [[nodiscard]]
+        static char* scanString(char* file, char*& contentEnd);
+
+        [[nodiscard]]
+        static char* findStringEnd(char* file);
+        [[nodiscard]]
+        static char* findBracket(char* file);
+        [[nodiscard]]
+        static char* skipContainer(char* file);
+        [[nodiscard]]
+        static char* skipValue(char* file);
+        [[nodiscard]]
+        static char* skipNumber(char* file);
+
+        //  Result of scanNumber. real is always set, magnitude only when the
+        //  number has neither fraction nor exponent and fits in 64 bits.
+        //
+        struct Number
+        {
+            bool negative = false;
+            bool integer = false;
+            uint64_t magnitude = 0;
+            double real = 0.0;
+        };
+
+        static const double exactPowersOfTen[23];
+        static const uint64_t powersOfFive[651][2];
+
+        [[nodiscard]]
+        static bool isEightDigits(const char* file);
+        [[nodiscard]]
+        static uint32_t parseEightDigits(const char* file);
+        [[nodiscard]]
+        static char* parseDigits(char* file, uint64_t& value);
+        [[nodiscard]]
+        static bool computeDouble(uint64_t mantissa, int64_t exponent, bool negative, double& result);
+        [[nodiscard]]
+        static bool scanNumber(char*& file, Number& number);
+        [[nodiscard]]
+        static Type numberType(const Number& number);
+
         void writeBool(std::ofstream& file);
         void writeInt(std::ofstream &file);
         void writeFloat(std::ofstream &file);
@@ -65,626 +379,5517 @@ class SJR
 
         void write(std::ofstream& file);
 
+        void parseBuffer(char* data, size_t size, const ParseOptions& options, Arena* arena,
+                         KeyTable* keys = nullptr);
+
         [[nodiscard]]
         bool parseBool(char*& file);
         [[nodiscard]]
         bool parseNumber(char*&file);
         [[nodiscard]]
-        bool parseString(char*& file);
-        [[nodiscard]]
-        bool parseArray(char*& file);
+        bool parseString(char*& file, Arena* arena);
+
         [[nodiscard]]
-        bool parseObject(char*& file);
+        static bool parseKey(char*& file, std::string_view& nodeName);
+
+        //  Hands out the start of each token to the parser, skipping the
+        //  whitespace before it.
+        //
+        struct ByteCursor
+        {
+            char* file;
+
+            [[nodiscard]]
+            char* peek()
+            {
+                skipWhiteSpace(file);
+                return file;
+            }
+
+            [[nodiscard]]
+            bool advance(char* end)
+            {
+                file = end;
+                return true;
+            }
+
+            [[nodiscard]]
+            bool skip()
+            {
+                char* end = skipValue(peek());
 
+                file = end;
+                return end != nullptr;
+            }
+        };
+
+        template<class Cursor, class Handler>
         [[nodiscard]]
-        bool parse(char*& file);
-};
+        static bool emitKey(Cursor& cursor, Handler& handler, const Projection* projection, uint32_t& selection,
+                            bool& closed);
+        template<class Cursor, class Handler>
+        [[nodiscard]]
+        static bool emitEvents(Cursor& cursor, Handler& handler, size_t maxDepth, const Projection* projection,
+                               std::vector<uint32_t>& containers);
+        template<class Handler>
+        [[nodiscard]]
+        static bool emitBuffer(char* data, size_t size, Handler& handler, const ParseOptions& options,
+                               std::vector<uint32_t>& containers);
 
-#ifdef SJR_IMPLEMENTATION
+        struct TreeBuilder;
+};
 
 
-//      ====================      ====================
-//      ====================PUBLIC====================
-//      ====================      ====================
+struct SJR::Member
+{
+    char* key;
+    uint32_t keyLength;
+    KeyStorage keyStorage;
+    SJR value;
+};
 
 
-void SJR::load(std::string_view filename)
+class SJR::Arena
 {
-    std::ifstream file(filename.data());
-    std::string str;
 
-    if (!file.is_open())
-    {
-        throw std::runtime_error("File cannot be opened.");
-    }
+    public:
 
-    file.seekg(0, std::ios::end);
-    str.reserve(file.tellg());
-    file.seekg(0, std::ios::beg);
+        Arena() = default;
+        Arena(const Arena&) = delete;
+        ~Arena();
 
-    str.assign((std::istreambuf_iterator<char>(file)),{});
+        Arena& operator= (const Arena&) = delete;
 
-    char* fileData = str.data();
+        [[nodiscard]]
+        void* allocate(size_t bytes);
 
-    if (!parse(fileData))
-    {
-        throw std::runtime_error("File doesn't correspong to json format file.");
-    }
+        void reset();
 
-}
+    private:
+
+        struct Chunk
+        {
+            Chunk* previous;
+            size_t size;
+        };
 
+        static constexpr size_t minimumChunkSize = 64 * 1024;
 
-[[nodiscard]]
-bool SJR::save(std::string_view filename)
-{
-    std::ofstream file(filename.data());
+        Chunk* chunks = nullptr;
+        char* current = nullptr;
+        char* end = nullptr;
+};
 
-    if (!file.is_open())
-    {
-        return false;
-    }
 
-    write(file);
+//  Views of the first occurrence of every key in a parsed buffer, in an
+//  open-addressing table. The parser hands out the stored view for every
+//  later occurrence, so the members of same-shaped objects share one copy of
+//  each key and equal keys compare by address.
+//
+//  For a tree that owns its keys, share stores a shared copy instead, and
+//  the table holds a reference to it until it is cleared.
+//
+class SJR::KeyTable
+{
 
-    file.close();
+    public:
 
-    return true;
-}
+        KeyTable() = default;
+        KeyTable(const KeyTable&) = delete;
+        ~KeyTable();
 
+        KeyTable& operator= (const KeyTable&) = delete;
 
-template<class T>
-void SJR::setValue(T newValue)
-{
-    if constexpr(std::is_same_v<T, bool>)
-    {
-        type = Type::BOOL;
-        value = std::to_string(newValue);
-    }
+        [[nodiscard]]
+        std::string_view intern(std::string_view key);
+        [[nodiscard]]
+        std::string_view share(std::string_view key);
+        [[nodiscard]]
+        std::string_view find(std::string_view key) const;
 
-    if constexpr(std::is_same_v<T, int>)
-    {
-        type = Type::INT;
-        value = std::to_string(newValue);
-    }
+        void clear();
 
-    if constexpr(std::is_same_v<T, float>)
-    {
-        type = Type::FLOAT;
-        value = std::to_string(newValue);
-    }
+    private:
 
-    if constexpr (std::is_same_v<T, std::string>)
-    {
-        type = Type::STRING;
-        value = newValue;
-    }
-}
+        static constexpr size_t minimumSize = 64;
 
+        std::vector<std::string_view> slots;
+        size_t count = 0;
+        bool shared = false;
 
-[[nodiscard]]
-SJR::Type SJR::getType() const
-{
-    return type;
-}
+        [[nodiscard]]
+        size_t probe(std::string_view key) const;
+        void grow();
+};
 
 
-template<class T>
-[[nodiscard]]
-T SJR::getValue() const
+//  Writable input of the parser: size() bytes followed by zero padding, so
+//  the parser can read past the end without checking. The parser decodes
+//  strings in place, which changes the contents.
+//
+//  A file is mapped privately, so in-place writes never reach it, over an
+//  anonymous reservation that supplies the padding. Small files, and systems
+//  without mmap, are read into the heap instead. A buffer made from a size
+//  is left for the caller to fill, e.g. straight from a socket, and then
+//  resized to the bytes actually written: the parser reads exactly size()
+//  bytes.
+//
+class SJR::PaddedBuffer
 {
-    if constexpr(std::is_same_v<T, bool> || std::is_same_v<T, int>)
-    {
-        return std::stoi(value);
-    }
 
-    if constexpr(std::is_same_v<T, float>)
-    {
-        return std::stof(value);
-    }
+    public:
 
-    if constexpr(std::is_same_v<T, std::string>)
-    {
-        return value;
-    }
-}
+        PaddedBuffer() = default;
+        explicit PaddedBuffer(size_t size);
+        explicit PaddedBuffer(std::string_view json);
+        PaddedBuffer(const PaddedBuffer&) = delete;
+        PaddedBuffer(PaddedBuffer&& other) noexcept;
+        ~PaddedBuffer();
 
+        PaddedBuffer& operator= (const PaddedBuffer&) = delete;
+        PaddedBuffer& operator= (PaddedBuffer&& other) noexcept;
 
-[[nodiscard]]
-size_t SJR::getChildCount() const
-{
-    return mapJson.size();
-}
+        void load(std::string_view filename);
+        void resize(size_t size);
 
+        [[nodiscard]]
+        char* data();
+        [[nodiscard]]
+        size_t size() const;
 
-[[nodiscard]]
-size_t SJR::getArraySize() const
-{
-    return vectorJson.size();
-}
+    private:
 
+        static constexpr size_t mapThreshold = 256 * 1024;
 
-[[nodiscard]]
-SJR& SJR::operator[] (std::string_view nodeName)
-{
-    auto it = mapJson.find(nodeName.data());
+        void release();
+        void allocate(size_t size);
+        void read(std::string_view filename);
 
-    if (it != mapJson.end())
-    {
-        return it->second;
-    }
-    else
-    {
-        return mapJson[nodeName.data()];
-    }
-}
+        char* bytes = nullptr;
+        size_t length = 0;
+        size_t mappedLength = 0;
+};
 
 
-//  Indexing starts with 0.
+//  Owner of a parsed tree whose nodes all come from one Arena. Destroying or
+//  clearing it releases the whole tree at once instead of node by node;
+//  containers reached through a non-const operator[] are moved to the heap
+//  first, so they can grow and whatever is added later is freed. Reads go
+//  through the const lookups, which leave the arena alone.
 //
-[[nodiscard]]
-SJR& SJR::operator[] (size_t index)
+//  The loaded buffer is kept as well: keys and string values are views into
+//  it rather than copies, with escape sequences decoded in place.
+//
+class SJR::Document
 {
-    if (type != Type::ARRAY)
-    {
-        vectorJson.resize(index);
-        type = Type::ARRAY;
-    }
 
-    if (index >= vectorJson.size())
-    {
-        vectorJson.resize(index + 1);
-    }
+    public:
 
-    return vectorJson.at(index);
-}
+        Document() = default;
+        Document(const Document&) = delete;
 
+        Document& operator= (const Document&) = delete;
 
-//      ====================       ====================
-//      ====================PRIVATE====================
-//      ====================       ====================
+        void load(std::string_view filename);
+        void load(std::string_view filename, const ParseOptions& options);
 
+        void parse(std::string_view json);
+        void parse(std::string_view json, const ParseOptions& options);
+        void parse(PaddedBuffer&& json);
+        void parse(PaddedBuffer&& json, const ParseOptions& options);
 
-void SJR::writeTabs(std::ofstream& file, size_t count)
-{
-    for (size_t i = 0u; i < count; ++i)
-    {
-        file << '\t';
-    }
-}
+        void clear();
 
+        [[nodiscard]]
+        SJR& root();
+        [[nodiscard]]
+        const SJR& root() const;
 
-void SJR::skipWhiteSpace(char*&file)
+        //  The document's own copy of a member name, or nodeName itself if no
+        //  member has it or keys were not interned. Lookups with the copy
+        //  match by address.
+        //
+        [[nodiscard]]
+        std::string_view key(std::string_view nodeName) const;
+
+    private:
+
+        PaddedBuffer buffer;
+        Arena arena;
+        KeyTable keys;
+        SJR rootNode;
+};
+
+
+//  Parser fed with chunks of input as they arrive. Parsing state, including
+//  the open containers, is kept across chunks, and every complete token is
+//  added to the tree as soon as it is seen. A token cut by a chunk boundary
+//  waits for the rest; only that unconsumed tail is kept.
+//
+//  feed reports DOCUMENT_READY once a whole document has been parsed; root()
+//  holds it until the next call. Input left after it starts the next
+//  document, which an empty feed continues: feed until it returns NEED_MORE
+//  before waiting for more input, or documents queue up unparsed. finish marks the end of input,
+//  which completes a number standing alone at the very end: it reports
+//  DOCUMENT_READY for a document that only the end completes, DONE once
+//  nothing but whitespace is left and ERROR for a truncated document. A
+//  document already reported stays in root() when finish finds nothing after
+//  it. After DONE or ERROR, reset() starts over.
+//
+class SJR::PushParser
 {
-    while (isspace(*file))
-    {
-        ++file;
-    }
-}
 
+    public:
+
+        enum class Status : int
+        {
+            NEED_MORE = 0,
+            DOCUMENT_READY = 1,
+            ERROR = 2,
+            DONE = 3,
+        };
+
+        PushParser() = default;
+        explicit PushParser(const ParseOptions& options);
+        PushParser(const PushParser&) = delete;
+
+        PushParser& operator= (const PushParser&) = delete;
+
+        [[nodiscard]]
+        Status feed(const char* data, size_t size);
+        [[nodiscard]]
+        Status finish();
+
+        void reset();
+
+        [[nodiscard]]
+        SJR& root();
+
+    private:
+
+        //  What the next token has to be.
+        //
+        enum class State : int
+        {
+            VALUE = 0,
+            OPENED = 1,
+            MEMBER = 2,
+            COLON = 3,
+            NEXT = 4,
+        };
+
+        //  Unconsumed input starting at position, then paddingSize zero bytes.
+        //  Everything before complete lies outside any unterminated string.
+        //
+        std::string pending;
+        size_t available = 0;
+        size_t position = 0;
+        size_t scanned = 0;
+        size_t complete = 0;
+        bool inString = false;
+        bool escaped = false;
+        bool finished = false;
+
+        std::vector<SJR*> containers;
+        SJR rootNode;
+        SJR* node = &rootNode;
+        State state = State::VALUE;
+        Status status = Status::NEED_MORE;
+        size_t maxDepth = ParseOptions{}.maxDepth;
+
+        void startDocument();
+        void scan();
+
+        [[nodiscard]]
+        bool isScalarComplete(const char* file) const;
+        [[nodiscard]]
+        Status run();
+};
+
+
+//  Reader of newline-delimited JSON: one document per line, blank lines
+//  skipped. Records are parsed one at a time in place, and each record
+//  reuses the arena, root node and container stack of the previous one, so a
+//  small record costs no allocation at all. Its strings are views into the
+//  buffer, which the reader keeps for as long as it lives.
+//
+//  root() holds the current record until the next call to next(). A line that
+//  is not valid JSON throws; reading can continue with the line after it.
+//
+class SJR::LineReader
+{
+
+    public:
+
+        LineReader() = default;
+        explicit LineReader(const ParseOptions& options);
+        LineReader(const LineReader&) = delete;
+
+        LineReader& operator= (const LineReader&) = delete;
+
+        void load(std::string_view filename);
+        void parse(std::string_view json);
+        void parse(PaddedBuffer&& json);
+
+        [[nodiscard]]
+        bool next();
+
+        [[nodiscard]]
+        SJR& root();
+
+    private:
+
+        PaddedBuffer buffer;
+        Arena arena;
+        SJR rootNode;
+        std::vector<SJR*> containers;
+        std::vector<uint32_t> levels;
+        size_t position = 0;
+        size_t maxDepth = ParseOptions{}.maxDepth;
+        const Projection* projection = nullptr;
+};
+
+
+static_assert(sizeof(SJR) <= 24, "SJR nodes must stay compact");
+
+
+//  Read-only form of a document: one contiguous tape of 64-bit entries in
+//  document order and one side buffer holding every string.
+//
+//  An entry keeps its Type in the top byte. Containers keep the tape index of
+//  their end entry and their child count in the rest, so a whole subtree is
+//  skipped in one step; 64-bit numbers keep their raw value in the next entry.
+//
+//  A tape with nothing parsed into it, or whose parse failed, holds an empty
+//  object, like a default SJR.
+//
+class SJR::Tape
+{
+
+    public:
+
+        Tape();
+
+        void load(std::string_view filename);
+
+        void parse(std::string_view json);
+        void parse(PaddedBuffer& buffer);
+
+        [[nodiscard]]
+        TapeView root() const;
+
+    private:
+
+        friend class TapeView;
+
+        static constexpr uint64_t ARRAY_END = 0x10;
+        static constexpr uint64_t OBJECT_END = 0x11;
+        static constexpr uint64_t MAX_COUNT = 0xFFFFFF;
+
+        std::vector<uint64_t> entries;
+        std::string strings;
+
+        void clear();
+        void appendEntry(uint64_t tag, uint64_t payload);
+        void appendString(std::string_view string);
+
+        struct Builder;
+
+        [[nodiscard]]
+        bool build(char* file);
+};
+
+
+class SJR::TapeView
+{
+
+    public:
+
+        [[nodiscard]]
+        Type getType() const;
+        template<class T>
+        [[nodiscard]]
+        T getValue() const;
+
+        [[nodiscard]]
+        size_t getChildCount() const;
+        [[nodiscard]]
+        size_t getArraySize() const;
+
+        TapeView operator[] (std::string_view nodeName) const;
+        TapeView operator[] (size_t index) const;
+
+    private:
+
+        friend class Tape;
+
+        const Tape* tape;
+        size_t index;
+
+        TapeView(const Tape* tape, size_t index);
+
+        [[nodiscard]]
+        uint64_t payload() const;
+        [[nodiscard]]
+        uint64_t word() const;
+        [[nodiscard]]
+        std::string_view string() const;
+        [[nodiscard]]
+        size_t countChildren() const;
+        [[nodiscard]]
+        size_t next() const;
+};
+
+
+//  Document that parses nothing up front. Its views walk the text when they
+//  are read: looking a child up steps over the values before it, and a whole
+//  container is skipped by matching brackets without parsing its contents.
+//  Nothing is decoded in place, so the text can be walked any number of
+//  times; a malformed value throws when it is reached.
+//
+class SJR::LazyDocument
+{
+
+    public:
+
+        LazyDocument() = default;
+        LazyDocument(const LazyDocument&) = delete;
+
+        LazyDocument& operator= (const LazyDocument&) = delete;
+
+        void load(std::string_view filename);
+        void parse(std::string_view json);
+        void parse(PaddedBuffer&& json);
+
+        [[nodiscard]]
+        LazyView root();
+
+    private:
+
+        PaddedBuffer buffer;
+};
+
+
+class SJR::LazyView
+{
+
+    public:
+
+        [[nodiscard]]
+        Type getType() const;
+        template<class T>
+        [[nodiscard]]
+        T getValue() const;
+
+        [[nodiscard]]
+        size_t getChildCount() const;
+        [[nodiscard]]
+        size_t getArraySize() const;
+
+        LazyView operator[] (std::string_view nodeName) const;
+        LazyView operator[] (size_t index) const;
+
+    private:
+
+        friend class LazyDocument;
+
+        char* value;
+
+        explicit LazyView(char* value);
+
+        [[nodiscard]]
+        Number number() const;
+        [[nodiscard]]
+        std::string string() const;
+        [[nodiscard]]
+        size_t countChildren() const;
+
+        [[nodiscard]]
+        static char* nextChild(char* file, char close);
+};
+
+
+//  Member paths to build, such as {"Ability/Attack", "GoldPerItem"}. Names
+//  are separated by '/'; the last one keeps the whole value, and the ones
+//  before it keep only their objects' members that lie on a path. An array
+//  on the way passes the path on to each of its elements, which all keep
+//  their places. A member that is a scalar where its path goes on is
+//  dropped. Everything else is stepped over without being parsed, so its
+//  contents are not validated.
+//
+//  Paths are compiled into a tree of names once, and may be shared by any
+//  number of parses.
+//
+class SJR::Projection
+{
+
+    public:
+
+        Projection() = default;
+        Projection(std::initializer_list<std::string_view> paths);
+
+        void add(std::string_view path);
+
+    private:
+
+        friend class SJR;
+
+        static constexpr uint32_t ALL = UINT32_MAX >> 1;
+        static constexpr uint32_t NONE = UINT32_MAX;
+
+        struct Node
+        {
+            std::vector<std::pair<std::string, uint32_t>> children;
+            bool whole = false;
+        };
+
+        std::vector<Node> nodes = std::vector<Node>(1);
+
+        [[nodiscard]]
+        uint32_t root() const;
+        [[nodiscard]]
+        uint32_t find(uint32_t node, std::string_view name) const;
+};
+
+
+//  Scalars are stored natively: reading one is a type check and a load, so
+//  these stay visible to every translation unit.
+//
+template<class T>
+void SJR::setValue(T newValue)
+{
+    static_assert(std::is_same_v<T, bool> || std::is_same_v<T, int> || std::is_same_v<T, float> ||
+                  std::is_same_v<T, int64_t> || std::is_same_v<T, uint64_t> || std::is_same_v<T, double> ||
+                  std::is_same_v<T, std::string>,
+                  "setValue takes bool, int, float, int64_t, uint64_t, double or std::string.");
+
+    if constexpr(std::is_same_v<T, bool>)
+    {
+        release();
+        type = Type::BOOL;
+        boolValue = newValue;
+    }
+
+    if constexpr(std::is_same_v<T, int>)
+    {
+        release();
+        type = Type::INT;
+        intValue = newValue;
+    }
+
+    if constexpr(std::is_same_v<T, float>)
+    {
+        release();
+        type = Type::FLOAT;
+        doubleValue = newValue;
+    }
+
+    if constexpr(std::is_same_v<T, int64_t>)
+    {
+        release();
+        type = Type::INT64;
+        intValue = newValue;
+    }
+
+    if constexpr(std::is_same_v<T, uint64_t>)
+    {
+        release();
+        type = Type::UINT64;
+        uintValue = newValue;
+    }
+
+    if constexpr(std::is_same_v<T, double>)
+    {
+        release();
+        type = Type::DOUBLE;
+        doubleValue = newValue;
+    }
+
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+        assignString(newValue.data(), newValue.size());
+    }
+}
+
+
+//  Numeric and boolean nodes convert to any arithmetic type; other nodes
+//  read as zero.
+//
+template<class T>
+[[nodiscard]]
+T SJR::getValue() const
+{
+    if constexpr(std::is_arithmetic_v<T>)
+    {
+        switch (type)
+        {
+            case Type::BOOL:
+                return static_cast<T>(boolValue);
+
+            case Type::INT:
+            case Type::INT64:
+                return static_cast<T>(intValue);
+
+            case Type::UINT64:
+                return static_cast<T>(uintValue);
+
+            case Type::FLOAT:
+            case Type::DOUBLE:
+                return static_cast<T>(doubleValue);
+
+            default:
+                return T{};
+        }
+    }
+
+    if constexpr(std::is_same_v<T, std::string>)
+    {
+        return type == Type::STRING ? std::string(stringData, count) : std::string();
+    }
+
+    if constexpr(std::is_same_v<T, std::string_view>)
+    {
+        return type == Type::STRING ? std::string_view(stringData, count) : std::string_view();
+    }
+}
+
+
+//  Arithmetic types are read from numeric and boolean nodes, strings from
+//  string nodes.
+//
+template<class T>
+[[nodiscard]]
+std::optional<T> SJR::tryGet(std::string_view nodeName) const
+{
+    const SJR* child = find(nodeName);
+
+    if (child == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    bool isString = child->type == Type::STRING;
+    bool isContainer = child->type == Type::ARRAY || child->type == Type::OBJECT;
+
+    if (std::is_arithmetic_v<T> ? isString || isContainer : !isString)
+    {
+        return std::nullopt;
+    }
+
+    return child->getValue<T>();
+}
+
+
+template<class T>
+[[nodiscard]]
+T SJR::TapeView::getValue() const
+{
+    if constexpr(std::is_arithmetic_v<T>)
+    {
+        switch (getType())
+        {
+            case Type::BOOL:
+                return static_cast<T>(payload() != 0);
+
+            case Type::INT:
+            case Type::INT64:
+                return static_cast<T>(static_cast<int64_t>(word()));
+
+            case Type::UINT64:
+                return static_cast<T>(word());
+
+            case Type::DOUBLE:
+            {
+                double real;
+                uint64_t bits = word();
+                memcpy(&real, &bits, sizeof(real));
+                return static_cast<T>(real);
+            }
+
+            default:
+                return T{};
+        }
+    }
+
+    if constexpr(std::is_same_v<T, std::string>)
+    {
+        return getType() == Type::STRING ? std::string(string()) : std::string();
+    }
+}
+
+template<class T>
+[[nodiscard]]
+T SJR::LazyView::getValue() const
+{
+    if constexpr(std::is_arithmetic_v<T>)
+    {
+        switch (getType())
+        {
+            case Type::BOOL:
+                return static_cast<T>(*value == 't');
+
+            case Type::INT:
+            case Type::INT64:
+            {
+                Number parsed = number();
+                return static_cast<T>(parsed.negative ? static_cast<int64_t>(0 - parsed.magnitude)
+                                                      : static_cast<int64_t>(parsed.magnitude));
+            }
+
+            case Type::UINT64:
+                return static_cast<T>(number().magnitude);
+
+            case Type::DOUBLE:
+                return static_cast<T>(number().real);
+
+            default:
+                return T{};
+        }
+    }
+
+    if constexpr(std::is_same_v<T, std::string>)
+    {
+        return getType() == Type::STRING ? string() : std::string();
+    }
+}
+
+
+template<class Handler>
+void SJR::parseEvents(std::string_view json, Handler& handler)
+{
+    parseEvents(json, handler, ParseOptions{});
+}
+
+
+template<class Handler>
+void SJR::parseEvents(std::string_view json, Handler& handler, const ParseOptions& options)
+{
+    PaddedBuffer buffer(json);
+
+    parseEvents(buffer, handler, options);
+}
+
+
+template<class Handler>
+void SJR::parseEvents(PaddedBuffer& buffer, Handler& handler)
+{
+    parseEvents(buffer, handler, ParseOptions{});
+}
+
+
+template<class Handler>
+void SJR::parseEvents(PaddedBuffer& buffer, Handler& handler, const ParseOptions& options)
+{
+    std::vector<uint32_t> containers;
+
+    if (!emitBuffer(buffer.data(), buffer.size(), handler, options, containers))
+    {
+        throw std::runtime_error("File doesn't correspong to json format file.");
+    }
+}
+
+
+//  Reads a member name and its colon. Under a projection, members off every
+//  path are stepped over until a selected one is found or the object ends,
+//  which closed reports. So are scalars where a path goes on: they hold
+//  nothing the rest of it could select. selection is the object's on entry
+//  and the member value's on return.
+//
+template<class Cursor, class Handler>
+[[nodiscard]]
+bool SJR::emitKey(Cursor& cursor, Handler& handler, const Projection* projection, uint32_t& selection,
+                  bool& closed)
+{
+    while (true)
+    {
+        char* file = cursor.peek();
+        std::string_view nodeName;
+
+        if (*file != '"' || !parseKey(file, nodeName))
+        {
+            return false;
+        }
+
+        if (!cursor.advance(file))
+        {
+            return false;
+        }
+
+        file = cursor.peek();
+
+        if (*file != ':')
+        {
+            return false;
+        }
+
+        if (!cursor.advance(file + 1))
+        {
+            return false;
+        }
+
+        uint32_t child = selection == Projection::ALL ? Projection::ALL : projection->find(selection, nodeName);
+        file = cursor.peek();
+
+        if (child != Projection::NONE && (child == Projection::ALL || *file == '{' || *file == '['))
+        {
+            handler.key(nodeName);
+            selection = child;
+            closed = false;
+
+            return true;
+        }
+
+        if (!cursor.skip())
+        {
+            return false;
+        }
+
+        file = cursor.peek();
+
+        if (*file == '}')
+        {
+            if (!cursor.advance(file + 1))
+            {
+                return false;
+            }
+
+            closed = true;
+
+            return true;
+        }
+
+        if (*file != ',')
+        {
+            return false;
+        }
+
+        if (!cursor.advance(file + 1))
+        {
+            return false;
+        }
+    }
+}
+
+
+//  Parses one value without recursion. The stack records, for each open
+//  container, whether it is an object and which projection node selects its
+//  contents. The first significant byte of a value decides the only token
+//  that can match.
+//
+//  containers is only storage, passed in so that it can be reused.
+//
+template<class Cursor, class Handler>
+[[nodiscard]]
+bool SJR::emitEvents(Cursor& cursor, Handler& handler, size_t maxDepth, const Projection* projection,
+                     std::vector<uint32_t>& containers)
+{
+    uint32_t selection = projection ? projection->root() : Projection::ALL;
+    bool closed;
+
+    containers.clear();
+
+    while (true)
+    {
+        char* file = cursor.peek();
+
+        switch (classify(*file))
+        {
+            case CharClass::QUOTE:
+            {
+                char* contentEnd;
+                char* end = scanString(file + 1, contentEnd);
+
+                if (end == nullptr)
+                {
+                    return false;
+                }
+
+                if (!cursor.advance(end + 1))
+                {
+                    return false;
+                }
+
+                handler.string(std::string_view(file + 1, contentEnd - file - 1));
+                break;
+            }
+
+            case CharClass::LITERAL:
+            {
+                bool isTrue = memcmp(file, "true", 4) == 0;
+
+                if (!isTrue && memcmp(file, "false", 5) != 0)
+                {
+                    return false;
+                }
+
+                if (!cursor.advance(file + (isTrue ? 4 : 5)))
+                {
+                    return false;
+                }
+
+                handler.boolean(isTrue);
+                break;
+            }
+
+            case CharClass::DIGIT:
+            case CharClass::SIGN:
+            {
+                Number number;
+
+                if (!scanNumber(file, number) || !cursor.advance(file))
+                {
+                    return false;
+                }
+
+                switch (numberType(number))
+                {
+                    case Type::UINT64:
+                        handler.unsignedInteger(number.magnitude);
+                        break;
+
+                    case Type::DOUBLE:
+                        handler.real(number.real);
+                        break;
+
+                    default:
+                        handler.integer(number.negative ? static_cast<int64_t>(0 - number.magnitude)
+                                                        : static_cast<int64_t>(number.magnitude));
+                        break;
+                }
+
+                break;
+            }
+
+            case CharClass::ARRAY_BEGIN:
+            case CharClass::OBJECT_BEGIN:
+            {
+                bool isObject = *file == '{';
+
+                if (containers.size() >= maxDepth)
+                {
+                    return false;
+                }
+
+                if (isObject)
+                {
+                    handler.startObject();
+                }
+                else
+                {
+                    handler.startArray();
+                }
+
+                if (!cursor.advance(file + 1))
+                {
+                    return false;
+                }
+
+                file = cursor.peek();
+
+                if (*file == (isObject ? '}' : ']'))
+                {
+                    if (!cursor.advance(file + 1))
+                    {
+                        return false;
+                    }
+
+                    handler.end();
+                    break;
+                }
+
+                if (!isObject)
+                {
+                    containers.push_back(selection << 1);
+                    continue;
+                }
+
+                containers.push_back(selection << 1 | 1);
+
+                if (!emitKey(cursor, handler, projection, selection, closed))
+                {
+                    return false;
+                }
+
+                if (!closed)
+                {
+                    continue;
+                }
+
+                containers.pop_back();
+                handler.end();
+                break;
+            }
+
+            default:
+                return false;
+        }
+
+        //  The value is complete: move on to the next value of the innermost
+        //  open container, closing containers on the way.
+        //
+        while (true)
+        {
+            if (containers.empty())
+            {
+                return true;
+            }
+
+            bool isObject = containers.back() & 1;
+            file = cursor.peek();
+
+            if (*file == ',')
+            {
+                if (!cursor.advance(file + 1))
+                {
+                    return false;
+                }
+
+                selection = containers.back() >> 1;
+
+                if (!isObject)
+                {
+                    break;
+                }
+
+                if (!emitKey(cursor, handler, projection, selection, closed))
+                {
+                    return false;
+                }
+
+                if (!closed)
+                {
+                    break;
+                }
+            }
+            else if (*file == (isObject ? '}' : ']'))
+            {
+                if (!cursor.advance(file + 1))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                return false;
+            }
+
+            containers.pop_back();
+            handler.end();
+        }
+    }
+}
+
+
+//  data must be followed by paddingSize zero bytes. Only whitespace may
+//  follow the root value.
+//
+template<class Handler>
+[[nodiscard]]
+bool SJR::emitBuffer(char* data, size_t size, Handler& handler, const ParseOptions& options,
+                     std::vector<uint32_t>& containers)
+{
+    size_t maxDepth = options.maxDepth < ParseOptions::depthLimit ? options.maxDepth : ParseOptions::depthLimit;
+    ByteCursor cursor{data};
+
+    return emitEvents(cursor, handler, maxDepth, options.projection, containers) &&
+           cursor.peek() == data + size;
+}
+
+
+#ifdef SJR_IMPLEMENTATION
+
+
+//      ====================      ====================
+//      ====================PUBLIC====================
+//      ====================      ====================
+
+
+SJR::SJR(const SJR& other)
+{
+    switch (other.type)
+    {
+        case Type::STRING:
+            assignString(other.stringData, other.count);
+            break;
+
+        case Type::ARRAY:
+            type = Type::ARRAY;
+            reserveChildren(other.count);
+
+            for (uint32_t i = 0; i < other.count; ++i)
+            {
+                new (arrayData + i) SJR(other.arrayData[i]);
+                ++count;
+            }
+
+            break;
+
+        case Type::OBJECT:
+            reserveChildren(other.count);
+
+            for (uint32_t i = 0; i < other.count; ++i)
+            {
+                const Member& member = other.objectData[i];
+                KeyStorage storage = member.keyStorage == KeyStorage::SHARED ? KeyStorage::SHARED : KeyStorage::OWNED;
+
+                appendMember(std::string_view(member.key, member.keyLength), nullptr, storage) = member.value;
+            }
+
+            if (capacity > indexThreshold)
+            {
+                buildIndex();
+            }
+
+            break;
+
+        default:
+            intValue = other.intValue;
+            type = other.type;
+            break;
+    }
+}
+
+
+SJR::SJR(SJR&& other) noexcept
+{
+    *this = std::move(other);
+}
+
+
+SJR::~SJR()
+{
+    release();
+}
+
+
+SJR& SJR::operator= (const SJR& other)
+{
+    if (this != &other)
+    {
+        *this = SJR(other);
+    }
+
+    return *this;
+}
+
+
+//  A node of a Document is copied instead: its blocks, or some below it,
+//  belong to the Document's arena and go away with it. Only that copy can
+//  allocate, and running out of memory there terminates, so that moving an
+//  owned tree, e.g. in a growing std::vector, never copies it.
+//
+SJR& SJR::operator= (SJR&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (other.borrowed || other.fromArena)
+        {
+            *this = SJR(static_cast<const SJR&>(other));
+        }
+        else
+        {
+            release();
+            steal(other);
+        }
+    }
+
+    return *this;
+}
+
+
+void SJR::load(std::string_view filename)
+{
+    load(filename, ParseOptions{});
+}
+
+
+void SJR::load(std::string_view filename, const ParseOptions& options)
+{
+    PaddedBuffer buffer;
+    buffer.load(filename);
+
+    parse(buffer, options);
+}
+
+
+void SJR::parse(std::string_view json)
+{
+    parse(json, ParseOptions{});
+}
+
+
+void SJR::parse(std::string_view json, const ParseOptions& options)
+{
+    PaddedBuffer buffer(json);
+
+    parse(buffer, options);
+}
+
+
+void SJR::parse(PaddedBuffer& buffer)
+{
+    parse(buffer, ParseOptions{});
+}
+
+
+//  Strings are copied out of the buffer, which can be reused afterwards.
+//
+//  Interned keys are shared by the members that have them; the table only
+//  lives for the parse.
+//
+void SJR::parse(PaddedBuffer& buffer, const ParseOptions& options)
+{
+    KeyTable keys;
+
+    parseBuffer(buffer.data(), buffer.size(), options, nullptr, options.internKeys ? &keys : nullptr);
+}
+
+
+[[nodiscard]]
+bool SJR::save(std::string_view filename)
+{
+    std::ofstream file(filename.data());
+
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    write(file);
+
+    file.close();
+
+    return true;
+}
+
+
+[[nodiscard]]
+SJR::Type SJR::getType() const
+{
+    return type;
+}
+
+
+[[nodiscard]]
+size_t SJR::getChildCount() const
+{
+    return type == Type::OBJECT ? count : 0;
+}
+
+
+[[nodiscard]]
+size_t SJR::getArraySize() const
+{
+    return type == Type::ARRAY ? count : 0;
+}
+
+
+//  Any other node becomes an empty object first. Keys are compared as views,
+//  so nothing is allocated unless a member is added. In an indexed object the
+//  key is hashed and probed once: a missing member takes the empty slot the
+//  probe ended on, unless the block has to grow and the index is rebuilt.
+//
+[[nodiscard]]
+SJR& SJR::operator[] (std::string_view nodeName)
+{
+    if (type != Type::OBJECT)
+    {
+        release();
+    }
+
+    detach();
+
+    return placeMember(nodeName);
+}
+
+
+//  Indexing starts with 0.
+//
+[[nodiscard]]
+SJR& SJR::operator[] (size_t index)
+{
+    if (type != Type::ARRAY)
+    {
+        release();
+        type = Type::ARRAY;
+    }
+
+    detach();
+
+    if (index >= count)
+    {
+        resizeArray(static_cast<uint32_t>(index + 1));
+    }
+
+    return arrayData[index];
+}
+
+
+[[nodiscard]]
+const SJR* SJR::find(std::string_view nodeName) const
+{
+    return type == Type::OBJECT ? findMember(nodeName) : nullptr;
+}
+
+
+[[nodiscard]]
+const SJR* SJR::find(size_t index) const
+{
+    return type == Type::ARRAY && index < count ? arrayData + index : nullptr;
+}
+
+
+[[nodiscard]]
+const SJR& SJR::at(std::string_view nodeName) const
+{
+    if (const SJR* child = find(nodeName))
+    {
+        return *child;
+    }
+
+    throw std::out_of_range("No such node.");
+}
+
+
+[[nodiscard]]
+const SJR& SJR::at(size_t index) const
+{
+    if (const SJR* child = find(index))
+    {
+        return *child;
+    }
+
+    throw std::out_of_range("No such node.");
+}
+
+
+[[nodiscard]]
+bool SJR::contains(std::string_view nodeName) const
+{
+    return find(nodeName) != nullptr;
+}
+
+
+//      ====================       ====================
+//      ====================PRIVATE====================
+//      ====================       ====================
+
+
+constexpr std::array<SJR::CharClass, 256> SJR::makeCharClasses()
+{
+    std::array<CharClass, 256> classes{};
+
+    classes[' '] = CharClass::WHITESPACE;
+    classes['\t'] = CharClass::WHITESPACE;
+    classes['\n'] = CharClass::WHITESPACE;
+    classes['\r'] = CharClass::WHITESPACE;
+
+    for (char c = '0'; c <= '9'; ++c)
+    {
+        classes[static_cast<unsigned char>(c)] = CharClass::DIGIT;
+    }
+
+    classes['"'] = CharClass::QUOTE;
+    classes['-'] = CharClass::SIGN;
+    classes['+'] = CharClass::SIGN;
+    classes['t'] = CharClass::LITERAL;
+    classes['f'] = CharClass::LITERAL;
+    classes['['] = CharClass::ARRAY_BEGIN;
+    classes['{'] = CharClass::OBJECT_BEGIN;
+    classes[']'] = CharClass::ARRAY_END;
+    classes['}'] = CharClass::OBJECT_END;
+    classes[':'] = CharClass::COLON;
+    classes[','] = CharClass::COMMA;
+    classes['\\'] = CharClass::BACKSLASH;
+
+    return classes;
+}
+
+
+const std::array<SJR::CharClass, 256> SJR::charClasses = SJR::makeCharClasses();
+
+
+constexpr std::array<char, 256> SJR::makeEscapeChars()
+{
+    std::array<char, 256> escapes{};
+
+    escapes['"'] = '"';
+    escapes['\\'] = '\\';
+    escapes['/'] = '/';
+    escapes['b'] = '\b';
+    escapes['f'] = '\f';
+    escapes['n'] = '\n';
+    escapes['r'] = '\r';
+    escapes['t'] = '\t';
+
+    return escapes;
+}
+
+
+const std::array<char, 256> SJR::escapeChars = SJR::makeEscapeChars();
+
+
+[[nodiscard]]
+SJR::CharClass SJR::classify(char c)
+{
+    return charClasses[static_cast<unsigned char>(c)];
+}
+
+
+[[nodiscard]]
+bool SJR::isWhiteSpace(char c)
+{
+    return classify(c) == CharClass::WHITESPACE;
+}
+
+
+[[nodiscard]]
+bool SJR::isDigit(char c)
+{
+    return classify(c) == CharClass::DIGIT;
+}
+
+
+[[nodiscard]]
+bool SJR::isOperator(char c)
+{
+    CharClass charClass = classify(c);
+
+    return charClass >= CharClass::ARRAY_BEGIN && charClass <= CharClass::COMMA;
+}
+
+
+//  Frees whatever the node owns and leaves it an empty object. Borrowed
+//  blocks are left to their Arena together with everything below them.
+//
+void SJR::release()
+{
+    if (!borrowed)
+    {
+        switch (type)
+        {
+            case Type::STRING:
+                delete[] stringData;
+                break;
+
+            case Type::ARRAY:
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    arrayData[i].~SJR();
+                }
+
+                ::operator delete(arrayData);
+                break;
+
+            case Type::OBJECT:
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    if (objectData[i].keyStorage == KeyStorage::OWNED)
+                    {
+                        delete[] objectData[i].key;
+                    }
+                    else if (objectData[i].keyStorage == KeyStorage::SHARED)
+                    {
+                        releaseKey(objectData[i].key);
+                    }
+
+                    objectData[i].value.~SJR();
+                }
+
+                ::operator delete(objectData);
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    intValue = 0;
+    count = 0;
+    capacity = 0;
+    type = Type::OBJECT;
+    borrowed = false;
+    indexed = false;
+    fromArena = false;
+}
+
+
+//  Takes other's blocks as they are, even those of an Arena: children are
+//  relocated this way, and their blocks stay where they were.
+//
+void SJR::steal(SJR& other) noexcept
+{
+    intValue = other.intValue;
+    count = other.count;
+    capacity = other.capacity;
+    type = other.type;
+    borrowed = other.borrowed;
+    indexed = other.indexed;
+    fromArena = other.fromArena;
+
+    other.intValue = 0;
+    other.count = 0;
+    other.capacity = 0;
+    other.type = Type::OBJECT;
+    other.borrowed = false;
+    other.indexed = false;
+    other.fromArena = false;
+}
+
+
+void SJR::assignString(const char* data, size_t length, Arena* arena)
+{
+    release();
+
+    stringData = arena ? static_cast<char*>(arena->allocate(length + 1)) : new char[length + 1];
+    memcpy(stringData, data, length);
+    stringData[length] = '\0';
+
+    count = static_cast<uint32_t>(length);
+    capacity = static_cast<uint32_t>(length + 1);
+    type = Type::STRING;
+    borrowed = arena != nullptr;
+}
+
+
+//  Turns the node into a view of a string owned by someone else.
+//
+void SJR::borrowString(const char* data, size_t length)
+{
+    release();
+
+    stringData = const_cast<char*>(data);
+    count = static_cast<uint32_t>(length);
+    capacity = static_cast<uint32_t>(length);
+    type = Type::STRING;
+    borrowed = true;
+}
+
+
+//  Children are relocated by stealing, so no subtree is ever copied. The new
+//  block comes from arena, or from the heap when arena is null.
+//
+void SJR::relocateChildren(uint32_t newCapacity, Arena* arena)
+{
+    if (type == Type::ARRAY)
+    {
+        SJR* children = static_cast<SJR*>(arena ? arena->allocate(sizeof(SJR) * newCapacity)
+                                                : ::operator new(sizeof(SJR) * newCapacity));
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            new (children + i) SJR();
+            children[i].steal(arrayData[i]);
+        }
+
+        if (!borrowed)
+        {
+            ::operator delete(arrayData);
+        }
+
+        arrayData = children;
+    }
+    else
+    {
+        size_t bytes = sizeof(Member) * newCapacity + (sizeof(uint32_t) + 1) * indexSize(newCapacity);
+        Member* members = static_cast<Member*>(arena ? arena->allocate(bytes) : ::operator new(bytes));
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            Member& member = objectData[i];
+
+            new (members + i) Member{member.key, member.keyLength, member.keyStorage, SJR()};
+            members[i].value.steal(member.value);
+        }
+
+        if (!borrowed)
+        {
+            ::operator delete(objectData);
+        }
+
+        objectData = members;
+    }
+
+    capacity = newCapacity;
+    borrowed = arena != nullptr;
+
+    if (indexed)
+    {
+        buildIndex();
+    }
+}
+
+
+void SJR::reserveChildren(uint32_t newCapacity, Arena* arena)
+{
+    if (newCapacity > capacity)
+    {
+        relocateChildren(newCapacity, arena);
+    }
+}
+
+
+//  Moves the children of a borrowed container to the heap. Their own blocks
+//  stay borrowed, which is why nothing below a borrowed block is ever freed.
+//
+void SJR::detach()
+{
+    if (borrowed && (type == Type::ARRAY || type == Type::OBJECT))
+    {
+        relocateChildren(capacity, nullptr);
+        fromArena = true;
+    }
+}
+
+
+void SJR::resizeArray(uint32_t newCount)
+{
+    reserveChildren(newCount);
+
+    for (; count < newCount; ++count)
+    {
+        new (arrayData + count) SJR();
+    }
+}
+
+
+//  New children are built in their final slot; the parser fills them there.
+//
+SJR& SJR::emplaceChild(Arena* arena)
+{
+    if (count == capacity)
+    {
+        reserveChildren(capacity < 4 ? 4 : capacity * 2, arena);
+    }
+
+    new (arrayData + count) SJR();
+
+    return arrayData[count++];
+}
+
+
+//  Searched from the back, so the last of duplicated keys wins; the index
+//  keeps only the last of them.
+//
+[[nodiscard]]
+SJR* SJR::findMember(std::string_view key) const
+{
+    if (indexed)
+    {
+        bool found;
+        uint32_t slot = probeIndex(key, hashKey(key), found);
+
+        return found ? &objectData[indexSlots()[slot]].value : nullptr;
+    }
+
+    for (uint32_t i = count; i-- > 0;)
+    {
+        Member& member = objectData[i];
+
+        if (matchKey(member, key))
+        {
+            return &member.value;
+        }
+    }
+
+    return nullptr;
+}
+
+
+//  Returns the member named key, appending it if there is none. An indexed
+//  object is probed once for both.
+//
+SJR& SJR::placeMember(std::string_view key, Arena* arena, KeyStorage storage)
+{
+    if (!indexed)
+    {
+        if (SJR* member = findMember(key))
+        {
+            return *member;
+        }
+
+        return emplaceMember(key, arena, storage);
+    }
+
+    uint64_t hash = hashKey(key);
+    bool found;
+    uint32_t slot = probeIndex(key, hash, found);
+
+    if (found)
+    {
+        return objectData[indexSlots()[slot]].value;
+    }
+
+    if (count == capacity)
+    {
+        return emplaceMember(key, arena, storage);
+    }
+
+    SJR& value = appendMember(key, arena, storage);
+
+    indexSlots()[slot] = count - 1;
+    indexControl()[slot] = static_cast<uint8_t>(hash & 0x7f);
+
+    return value;
+}
+
+
+//  Keeps the index up to date, building it once the object has outgrown
+//  scanning.
+//
+SJR& SJR::emplaceMember(std::string_view key, Arena* arena, KeyStorage storage)
+{
+    SJR& value = appendMember(key, arena, storage);
+
+    if (indexed)
+    {
+        indexMember(count - 1);
+    }
+    else if (capacity > indexThreshold)
+    {
+        buildIndex();
+    }
+
+    return value;
+}
+
+
+//  Leaves the index alone for the caller to update. An owned key is copied;
+//  a borrowed one, such as a view into the buffer a Document keeps, is used
+//  as it is, and a shared one gains a reference.
+//
+SJR& SJR::appendMember(std::string_view key, Arena* arena, KeyStorage storage)
+{
+    if (count == capacity)
+    {
+        reserveChildren(capacity < 4 ? 4 : capacity * 2, arena);
+    }
+
+    char* keyData = const_cast<char*>(key.data());
+
+    if (storage == KeyStorage::OWNED)
+    {
+        keyData = new char[key.size() + 1];
+        memcpy(keyData, key.data(), key.size());
+        keyData[key.size()] = '\0';
+    }
+    else if (storage == KeyStorage::SHARED)
+    {
+        retainKey(keyData);
+    }
+
+    new (objectData + count) Member{keyData, static_cast<uint32_t>(key.size()), storage, SJR()};
+
+    return objectData[count++].value;
+}
+
+
+//  A shared key is preceded in its block by its reference count, which is
+//  atomic so that trees sharing keys can be copied and destroyed on
+//  different threads.
+//
+[[nodiscard]]
+char* SJR::shareKey(std::string_view key)
+{
+    char* block = static_cast<char*>(::operator new(sizeof(std::atomic<uint32_t>) + key.size() + 1));
+    char* keyData = block + sizeof(std::atomic<uint32_t>);
+
+    new (block) std::atomic<uint32_t>(1);
+    memcpy(keyData, key.data(), key.size());
+    keyData[key.size()] = '\0';
+
+    return keyData;
+}
+
+
+void SJR::retainKey(char* key)
+{
+    reinterpret_cast<std::atomic<uint32_t>*>(key - sizeof(std::atomic<uint32_t>))->fetch_add(1, std::memory_order_relaxed);
+}
+
+
+void SJR::releaseKey(char* key)
+{
+    char* block = key - sizeof(std::atomic<uint32_t>);
+    auto* references = reinterpret_cast<std::atomic<uint32_t>*>(block);
+
+    if (references->fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        references->~atomic();
+        ::operator delete(block);
+    }
+}
+
+
+//  Keys of a Document are interned, so an interned key passed in matches by
+//  address without its bytes being read.
+//
+[[nodiscard]]
+bool SJR::matchKey(const Member& member, std::string_view key)
+{
+    return member.keyLength == key.size() &&
+           (member.key == key.data() || std::string_view(member.key, member.keyLength) == key);
+}
+
+
+//  Keys are read a word at a time, each word folded in with a multiply and a
+//  shift.
+//
+[[nodiscard]]
+uint64_t SJR::hashKey(std::string_view key)
+{
+    uint64_t hash = 0x9e3779b97f4a7c15 ^ key.size();
+    size_t i = 0;
+
+    for (; i + 8 <= key.size(); i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, key.data() + i, 8);
+
+        hash = (hash ^ word) * 0xbf58476d1ce4e5b9;
+        hash ^= hash >> 31;
+    }
+
+    if (i < key.size())
+    {
+        uint64_t word = 0;
+        memcpy(&word, key.data() + i, key.size() - i);
+
+        hash = (hash ^ word) * 0xbf58476d1ce4e5b9;
+        hash ^= hash >> 31;
+    }
+
+    hash *= 0x94d049bb133111eb;
+
+    return hash ^ hash >> 29;
+}
+
+
+//  Slots in the index of an object of the given capacity: a power of two, so
+//  that no more than seven of eight slots are ever full. Zero below the
+//  threshold.
+//
+[[nodiscard]]
+uint32_t SJR::indexSize(uint32_t capacity)
+{
+    if (capacity <= indexThreshold)
+    {
+        return 0;
+    }
+
+    uint32_t size = 2 * groupSize;
+
+    while (size < capacity + capacity / 7)
+    {
+        size *= 2;
+    }
+
+    return size;
+}
+
+
+//  Returns a bit for every control byte of the group equal to control.
+//
+[[nodiscard]]
+uint32_t SJR::matchControl(const uint8_t* group, uint8_t control)
+{
+#if defined(__SSE2__)
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(static_cast<char>(control)))));
+#else
+    uint32_t mask = 0;
+
+    for (uint32_t i = 0; i < groupSize; ++i)
+    {
+        mask |= group[i] == control ? uint32_t{1} << i : 0;
+    }
+
+    return mask;
+#endif
+}
+
+
+[[nodiscard]]
+uint32_t* SJR::indexSlots() const
+{
+    return reinterpret_cast<uint32_t*>(objectData + capacity);
+}
+
+
+[[nodiscard]]
+uint8_t* SJR::indexControl() const
+{
+    return reinterpret_cast<uint8_t*>(indexSlots() + indexSize(capacity));
+}
+
+
+//  Returns the slot holding key, or the empty slot it would go in, which
+//  found tells apart. Groups are probed in triangular steps, which reach
+//  every group of a power-of-two table. Keys are only compared where the
+//  control byte already matches.
+//
+[[nodiscard]]
+uint32_t SJR::probeIndex(std::string_view key, uint64_t hash, bool& found) const
+{
+    const uint32_t* slots = indexSlots();
+    const uint8_t* control = indexControl();
+    uint8_t tag = static_cast<uint8_t>(hash & 0x7f);
+    uint32_t groupMask = indexSize(capacity) / groupSize - 1;
+    uint32_t group = static_cast<uint32_t>(hash >> 7) & groupMask;
+
+    for (uint32_t step = 1;; group = (group + step++) & groupMask)
+    {
+        const uint8_t* bytes = control + group * groupSize;
+
+        for (uint32_t matches = matchControl(bytes, tag); matches != 0; matches &= matches - 1)
+        {
+            uint32_t slot = group * groupSize + countTrailingZeros(matches);
+            const Member& member = objectData[slots[slot]];
+
+            if (matchKey(member, key))
+            {
+                found = true;
+                return slot;
+            }
+        }
+
+        if (uint32_t empties = matchControl(bytes, emptyControl))
+        {
+            found = false;
+            return group * groupSize + countTrailingZeros(empties);
+        }
+    }
+}
+
+
+//  A member whose key is already indexed takes over its slot.
+//
+void SJR::indexMember(uint32_t position)
+{
+    const Member& member = objectData[position];
+    std::string_view key(member.key, member.keyLength);
+    uint64_t hash = hashKey(key);
+    bool found;
+    uint32_t slot = probeIndex(key, hash, found);
+
+    indexSlots()[slot] = position;
+    indexControl()[slot] = static_cast<uint8_t>(hash & 0x7f);
+}
+
+
+void SJR::buildIndex()
+{
+    memset(indexControl(), emptyControl, indexSize(capacity));
+    indexed = true;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        indexMember(i);
+    }
+}
+
+
+void SJR::writeTabs(std::ofstream& file, size_t count)
+{
+    for (size_t i = 0u; i < count; ++i)
+    {
+        file << '\t';
+    }
+}
+
+
+//  Writes the bytes that need no escaping in runs, and quotes, backslashes
+//  and control characters as escape sequences.
+//
+void SJR::writeEscaped(std::ofstream& file, const char* data, size_t length)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+
+    const char* run = data;
+    const char* end = data + length;
+
+    for (const char* current = data; current != end; ++current)
+    {
+        unsigned char c = static_cast<unsigned char>(*current);
+
+        if (c >= 0x20 && c != '"' && c != '\\')
+        {
+            continue;
+        }
+
+        file.write(run, current - run);
+        run = current + 1;
+
+        switch (c)
+        {
+            case '"':
+                file << "\\\"";
+                break;
+
+            case '\\':
+                file << "\\\\";
+                break;
+
+            case '\b':
+                file << "\\b";
+                break;
+
+            case '\f':
+                file << "\\f";
+                break;
+
+            case '\n':
+                file << "\\n";
+                break;
+
+            case '\r':
+                file << "\\r";
+                break;
+
+            case '\t':
+                file << "\\t";
+                break;
+
+            default:
+                file << "\\u00" << hexDigits[c >> 4] << hexDigits[c & 0xF];
+                break;
+        }
+    }
+
+    file.write(run, end - run);
+}
+
+
+void SJR::skipWhiteSpace(char*&file)
+{
+    while (isWhiteSpace(*file))
+    {
+        ++file;
+    }
+}
+
+
+//  bits must not be zero.
+//
+[[nodiscard]]
+int SJR::countTrailingZeros(uint64_t bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(bits);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanForward64(&index, bits);
+
+    return static_cast<int>(index);
+#else
+    static constexpr int positions[64] =
+    {
+        0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4,
+        62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+        63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+        46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6,
+    };
+
+    return positions[((bits & (~bits + 1)) * 0x03f79d71b4cb0a89) >> 58];
+#endif
+}
+
+
+//  bits must not be zero.
+//
+[[nodiscard]]
+int SJR::countLeadingZeros(uint64_t bits)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(bits);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanReverse64(&index, bits);
+
+    return 63 - static_cast<int>(index);
+#else
+    int count = 0;
+
+    for (int shift = 32; shift > 0; shift /= 2)
+    {
+        if ((bits >> (64 - shift)) == 0)
+        {
+            bits <<= shift;
+            count += shift;
+        }
+    }
+
+    return count;
+#endif
+}
+
+
+//  Full 128-bit product: returns the upper half and stores the lower one.
+//
+[[nodiscard]]
+uint64_t SJR::multiplyHigh(uint64_t left, uint64_t right, uint64_t& low)
+{
+#if defined(__SIZEOF_INT128__)
+    __extension__ typedef unsigned __int128 Product;
+
+    Product product = static_cast<Product>(left) * right;
+    low = static_cast<uint64_t>(product);
+
+    return static_cast<uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    uint64_t high;
+    low = _umul128(left, right, &high);
+
+    return high;
+#else
+    uint64_t leftLow = left & 0xFFFFFFFF;
+    uint64_t leftHigh = left >> 32;
+    uint64_t rightLow = right & 0xFFFFFFFF;
+    uint64_t rightHigh = right >> 32;
+
+    uint64_t lowLow = leftLow * rightLow;
+    uint64_t highLow = leftHigh * rightLow;
+    uint64_t lowHigh = leftLow * rightHigh;
+    uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFF) + (lowHigh & 0xFFFFFFFF);
+
+    low = (middle << 32) | (lowLow & 0xFFFFFFFF);
+
+    return leftHigh * rightHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+#endif
+}
+
+
+//  value = value * 10 + digit, or false, leaving value alone, if that does not
+//  fit in 64 bits.
+//
+[[nodiscard]]
+bool SJR::appendDigit(uint64_t& value, uint64_t digit)
+{
+    if (value > (std::numeric_limits<uint64_t>::max() - digit) / 10)
+    {
+        return false;
+    }
+
+    value = value * 10 + digit;
+    return true;
+}
+
+
+//  Returns the first quote, backslash or zero byte at or after file. The body
+//  of a string is searched a whole vector at a time for the only three bytes
+//  that matter.
+//
+[[nodiscard]]
+char* SJR::findStringStop(char* file)
+{
+    while (true)
+    {
+#if defined(__AVX2__)
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(file));
+        __m256i stops = _mm256_or_si256(_mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('"')),
+                                        _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('\\')));
+        stops = _mm256_or_si256(stops, _mm256_cmpeq_epi8(bytes, _mm256_setzero_si256()));
+
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(stops));
+
+        if (mask == 0)
+        {
+            file += 32;
+            continue;
+        }
+
+        file += countTrailingZeros(mask);
+#elif defined(__SSE2__)
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(file));
+        __m128i stops = _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8('"')),
+                                     _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\\')));
+        stops = _mm_or_si128(stops, _mm_cmpeq_epi8(bytes, _mm_setzero_si128()));
+
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(stops));
+
+        if (mask == 0)
+        {
+            file += 16;
+            continue;
+        }
+
+        file += countTrailingZeros(mask);
+#else
+        while (*file != '"' && *file != '\\' && *file != '\0')
+        {
+            ++file;
+        }
+#endif
+
+        return file;
+    }
+}
+
+
+[[nodiscard]]
+bool SJR::parseHex(const char* file, uint32_t& value)
+{
+    value = 0;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        char c = file[i];
+        char lower = static_cast<char>(c | 0x20);
+
+        if (c >= '0' && c <= '9')
+        {
+            value = value << 4 | static_cast<uint32_t>(c - '0');
+        }
+        else if (lower >= 'a' && lower <= 'f')
+        {
+            value = value << 4 | static_cast<uint32_t>(lower - 'a' + 10);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+//  Decodes the escape sequence at file into out and returns the byte after
+//  it, or nullptr if it is invalid. A sequence is never shorter than what it
+//  decodes to, so out can trail file in the same buffer. Surrogate pairs are
+//  joined and every code point is written as UTF-8.
+//
+[[nodiscard]]
+char* SJR::decodeEscape(char* file, char*& out)
+{
+    char escaped = escapeChars[static_cast<unsigned char>(file[1])];
+
+    if (escaped != '\0')
+    {
+        *out++ = escaped;
+        return file + 2;
+    }
+
+    uint32_t codePoint;
+
+    if (file[1] != 'u' || !parseHex(file + 2, codePoint))
+    {
+        return nullptr;
+    }
+
+    file += 6;
+
+    if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+    {
+        uint32_t low;
+
+        if (codePoint > 0xDBFF || file[0] != '\\' || file[1] != 'u' || !parseHex(file + 2, low)
+            || low < 0xDC00 || low > 0xDFFF)
+        {
+            return nullptr;
+        }
+
+        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+        file += 6;
+    }
+
+    if (codePoint < 0x80)
+    {
+        *out++ = static_cast<char>(codePoint);
+    }
+    else if (codePoint < 0x800)
+    {
+        *out++ = static_cast<char>(0xC0 | codePoint >> 6);
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else if (codePoint < 0x10000)
+    {
+        *out++ = static_cast<char>(0xE0 | codePoint >> 12);
+        *out++ = static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else
+    {
+        *out++ = static_cast<char>(0xF0 | codePoint >> 18);
+        *out++ = static_cast<char>(0x80 | (codePoint >> 12 & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint >> 6 & 0x3F));
+        *out++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+
+    return file;
+}
+
+
+//  Returns the closing quote of the string whose body starts at file, or
+//  nullptr if the buffer ends first or an escape sequence is invalid. The
+//  body is decoded in place: contentEnd receives the end of the decoded
+//  bytes, which is the quote itself unless there were escapes.
+//
+[[nodiscard]]
+char* SJR::scanString(char* file, char*& contentEnd)
+{
+    char* stop = findStringStop(file);
+    char* out = stop;
+
+    while (*stop == '\\')
+    {
+        file = decodeEscape(stop, out);
+
+        if (file == nullptr)
+        {
+            return nullptr;
+        }
+
+        stop = findStringStop(file);
+        memmove(out, file, stop - file);
+        out += stop - file;
+    }
+
+    if (*stop != '"')
+    {
+        return nullptr;
+    }
+
+    contentEnd = out;
+
+    return stop;
+}
+
+
+//  Like scanString, but leaves the escape sequences as they are.
+//
+[[nodiscard]]
+char* SJR::findStringEnd(char* file)
+{
+    while (true)
+    {
+        file = findStringStop(file);
+
+        if (*file == '"')
+        {
+            return file;
+        }
+
+        if (*file == '\0' || file[1] == '\0')
+        {
+            return nullptr;
+        }
+
+        file += 2;
+    }
+}
+
+
+//  Returns the first quote, bracket or brace, or zero byte at or after file.
+//  '[' and '{', like ']' and '}', differ only in bit 5, so two comparisons
+//  find all four.
+//
+[[nodiscard]]
+char* SJR::findBracket(char* file)
+{
+    while (true)
+    {
+#if defined(__AVX2__)
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(file));
+        __m256i folded = _mm256_or_si256(bytes, _mm256_set1_epi8(0x20));
+        __m256i stops = _mm256_or_si256(_mm256_cmpeq_epi8(folded, _mm256_set1_epi8('{')),
+                                        _mm256_cmpeq_epi8(folded, _mm256_set1_epi8('}')));
+        stops = _mm256_or_si256(stops, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('"')));
+        stops = _mm256_or_si256(stops, _mm256_cmpeq_epi8(bytes, _mm256_setzero_si256()));
+
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(stops));
+
+        if (mask == 0)
+        {
+            file += 32;
+            continue;
+        }
+
+        file += countTrailingZeros(mask);
+#elif defined(__SSE2__)
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(file));
+        __m128i folded = _mm_or_si128(bytes, _mm_set1_epi8(0x20));
+        __m128i stops = _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+                                     _mm_cmpeq_epi8(folded, _mm_set1_epi8('}')));
+        stops = _mm_or_si128(stops, _mm_cmpeq_epi8(bytes, _mm_set1_epi8('"')));
+        stops = _mm_or_si128(stops, _mm_cmpeq_epi8(bytes, _mm_setzero_si128()));
+
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(stops));
+
+        if (mask == 0)
+        {
+            file += 16;
+            continue;
+        }
+
+        file += countTrailingZeros(mask);
+#else
+        while ((*file | 0x20) != '{' && (*file | 0x20) != '}' && *file != '"' && *file != '\0')
+        {
+            ++file;
+        }
+#endif
+
+        return file;
+    }
+}
+
+
+//  Returns the byte after the container opened at file, or nullptr if the
+//  buffer ends first. Only brackets and strings are looked at, so the
+//  contents are not validated.
+//
+[[nodiscard]]
+char* SJR::skipContainer(char* file)
+{
+    size_t depth = 0;
+
+    while (true)
+    {
+        file = findBracket(file);
+
+        switch (*file)
+        {
+            case '"':
+                file = findStringEnd(file + 1);
+
+                if (file == nullptr)
+                {
+                    return nullptr;
+                }
+
+                break;
+
+            case '[':
+            case '{':
+                ++depth;
+                break;
+
+            case ']':
+            case '}':
+                if (--depth == 0)
+                {
+                    return file + 1;
+                }
+
+                break;
+
+            default:
+                return nullptr;
+        }
+
+        ++file;
+    }
+}
+
+
+//  Returns the byte after the value starting at file, or nullptr if it is
+//  malformed.
+//
+[[nodiscard]]
+char* SJR::skipValue(char* file)
+{
+    switch (classify(*file))
+    {
+        case CharClass::QUOTE:
+        {
+            char* end = findStringEnd(file + 1);
+            return end ? end + 1 : nullptr;
+        }
+
+        case CharClass::LITERAL:
+            if (memcmp(file, "true", 4) == 0)
+            {
+                return file + 4;
+            }
+
+            return memcmp(file, "false", 5) == 0 ? file + 5 : nullptr;
+
+        case CharClass::DIGIT:
+        case CharClass::SIGN:
+            return skipNumber(file);
+
+        case CharClass::ARRAY_BEGIN:
+        case CharClass::OBJECT_BEGIN:
+            return skipContainer(file);
+
+        default:
+            return nullptr;
+    }
+}
+
+
+//  Accepts what scanNumber accepts without converting anything, for numbers
+//  that are skipped.
+//
+[[nodiscard]]
+char* SJR::skipNumber(char* file)
+{
+    if (*file == '-' || *file == '+')
+    {
+        ++file;
+    }
+
+    if (!isDigit(*file))
+    {
+        return nullptr;
+    }
+
+    while (isDigit(*file))
+    {
+        ++file;
+    }
+
+    if (*file == '.')
+    {
+        ++file;
+
+        if (!isDigit(*file))
+        {
+            return nullptr;
+        }
+
+        while (isDigit(*file))
+        {
+            ++file;
+        }
+    }
+
+    if (*file == 'e' || *file == 'E')
+    {
+        ++file;
+
+        if (*file == '-' || *file == '+')
+        {
+            ++file;
+        }
+
+        if (!isDigit(*file))
+        {
+            return nullptr;
+        }
+
+        while (isDigit(*file))
+        {
+            ++file;
+        }
+    }
+
+    return file;
+}
+
+
+//  Eight ASCII digits are checked and converted as one little-endian word.
+//
+[[nodiscard]]
+bool SJR::isEightDigits(const char* file)
+{
+    uint64_t word;
+    memcpy(&word, file, sizeof(word));
+
+    return ((word & 0xF0F0F0F0F0F0F0F0) | (((word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4))
+           == 0x3333333333333333;
+}
+
+
+[[nodiscard]]
+uint32_t SJR::parseEightDigits(const char* file)
+{
+    uint64_t word;
+    memcpy(&word, file, sizeof(word));
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+
+    word -= 0x3030303030303030;
+    word = (word * 10) + (word >> 8);
+    word = (((word & 0x000000FF000000FF) * 0x000F424000000064)
+            + (((word >> 16) & 0x000000FF000000FF) * 0x0000271000000001)) >> 32;
+
+    return static_cast<uint32_t>(word);
+}
+
+
+//  Appends a run of decimal digits to value, which silently wraps once more
+//  than nineteen digits have been accumulated.
+//
+[[nodiscard]]
+char* SJR::parseDigits(char* file, uint64_t& value)
+{
+    while (isEightDigits(file))
+    {
+        value = value * 100000000 + parseEightDigits(file);
+        file += 8;
+    }
+
+    while (isDigit(*file))
+    {
+        value = value * 10 + static_cast<uint64_t>(*file - '0');
+        ++file;
+    }
+
+    return file;
+}
+
+
+//  mantissa * 10^exponent correctly rounded to a double: exact for small
+//  operands (Clinger), otherwise by the Eisel-Lemire algorithm. Returns false
+//  only for subnormal results, which are left to the slow path.
+//
+[[nodiscard]]
+bool SJR::computeDouble(uint64_t mantissa, int64_t exponent, bool negative, double& result)
+{
+    constexpr double infinity = std::numeric_limits<double>::infinity();
+
+    if (mantissa == 0 || exponent < -342)
+    {
+        result = negative ? -0.0 : 0.0;
+        return true;
+    }
+
+    if (exponent > 308)
+    {
+        result = negative ? -infinity : infinity;
+        return true;
+    }
+
+    if (mantissa <= (uint64_t{1} << 53) && exponent >= -22 && exponent <= 22)
+    {
+        double real = static_cast<double>(mantissa);
+        real = exponent < 0 ? real / exactPowersOfTen[-exponent] : real * exactPowersOfTen[exponent];
+        result = negative ? -real : real;
+        return true;
+    }
+
+    int leadingZeros = countLeadingZeros(mantissa);
+    uint64_t normalized = mantissa << leadingZeros;
+    const uint64_t* power = powersOfFive[exponent + 342];
+
+    uint64_t low;
+    uint64_t high = multiplyHigh(normalized, power[0], low);
+
+    if ((high & 0x1FF) == 0x1FF)
+    {
+        uint64_t correctionLow;
+        uint64_t correctionHigh = multiplyHigh(normalized, power[1], correctionLow);
+
+        low += correctionHigh;
+
+        if (correctionHigh > low)
+        {
+            ++high;
+        }
+    }
+
+    int upperBit = static_cast<int>(high >> 63);
+    uint64_t bits = high >> (upperBit + 9);
+    int64_t binaryExponent = (((152170 + 65536) * exponent) >> 16) + 63 + upperBit - leadingZeros + 1023;
+
+    if (binaryExponent <= 0)
+    {
+        return false;
+    }
+
+    //  Exactly halfway between two doubles: round to even instead of up.
+    if (low <= 1 && exponent >= -4 && exponent <= 23 && (bits & 3) == 1 && (bits << (upperBit + 9)) == high)
+    {
+        bits &= ~uint64_t{1};
+    }
+
+    bits += bits & 1;
+    bits >>= 1;
+
+    if (bits >= (uint64_t{2} << 52))
+    {
+        bits = uint64_t{1} << 52;
+        ++binaryExponent;
+    }
+
+    if (binaryExponent >= 2047)
+    {
+        result = negative ? -infinity : infinity;
+        return true;
+    }
+
+    bits &= ~(uint64_t{1} << 52);
+    bits |= static_cast<uint64_t>(binaryExponent) << 52;
+    bits |= static_cast<uint64_t>(negative) << 63;
+
+    memcpy(&result, &bits, sizeof(result));
+    return true;
+}
+
+
+[[nodiscard]]
+bool SJR::scanNumber(char*& file, Number& number)
+{
+    char* begin = *file == '+' ? file + 1 : file;
+    char* current = file;
+
+    number.negative = *current == '-';
+
+    if (*current == '-' || *current == '+')
+    {
+        ++current;
+    }
+
+    if (!isDigit(*current))
+    {
+        return false;
+    }
+
+    char* digits = current;
+    uint64_t mantissa = 0;
+    int64_t exponent = 0;
+    bool integer = true;
+
+    current = parseDigits(current, mantissa);
+    size_t digitCount = current - digits;
+
+    if (*current == '.')
+    {
+        ++current;
+        integer = false;
+
+        char* fraction = current;
+        current = parseDigits(current, mantissa);
+
+        if (current == fraction)
+        {
+            return false;
+        }
+
+        digitCount += current - fraction;
+        exponent = fraction - current;
+    }
+
+    if (*current == 'e' || *current == 'E')
+    {
+        ++current;
+        integer = false;
+
+        bool negativeExponent = *current == '-';
+
+        if (*current == '-' || *current == '+')
+        {
+            ++current;
+        }
+
+        if (!isDigit(*current))
+        {
+            return false;
+        }
+
+        int64_t written = 0;
+
+        while (isDigit(*current))
+        {
+            if (written < 0x10000000)
+            {
+                written = written * 10 + (*current - '0');
+            }
+
+            ++current;
+        }
+
+        exponent += negativeExponent ? -written : written;
+    }
+
+    file = current;
+
+    for (char* leading = digits; *leading == '0' || *leading == '.'; ++leading)
+    {
+        digitCount -= *leading == '0';
+    }
+
+    number.integer = integer && digitCount <= 19;
+    number.magnitude = mantissa;
+
+    if (integer && digitCount == 20)
+    {
+        uint64_t magnitude = 0;
+        bool overflow = false;
+
+        for (char* digit = digits; digit != current; ++digit)
+        {
+            overflow |= !appendDigit(magnitude, static_cast<uint64_t>(*digit - '0'));
+        }
+
+        number.integer = !overflow;
+        number.magnitude = magnitude;
+    }
+
+    if (digitCount <= 19 && computeDouble(mantissa, exponent, number.negative, number.real))
+    {
+        return true;
+    }
+
+    //  More significant digits than fit in 64 bits, or a subnormal result.
+    auto result = std::from_chars(begin, current, number.real);
+
+    if (result.ec == std::errc::result_out_of_range)
+    {
+        bool overflow = static_cast<int64_t>(digitCount) + exponent > 0;
+        double magnitude = overflow ? std::numeric_limits<double>::infinity() : 0.0;
+
+        number.real = number.negative ? -magnitude : magnitude;
+    }
+
+    return true;
+}
+
+
+//  The narrowest type that holds the number exactly.
+//
+[[nodiscard]]
+SJR::Type SJR::numberType(const Number& number)
+{
+    uint64_t intLimit = static_cast<uint64_t>(std::numeric_limits<int>::max()) + number.negative;
+    uint64_t int64Limit = static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + number.negative;
+
+    if (number.integer && number.magnitude <= int64Limit)
+    {
+        return number.magnitude <= intLimit ? Type::INT : Type::INT64;
+    }
+
+    if (number.integer && !number.negative)
+    {
+        return Type::UINT64;
+    }
+
+    return Type::DOUBLE;
+}
+
+
+void SJR::writeBool(std::ofstream& file)
+{
+    file.setf(std::ios_base::boolalpha);
+    file << boolValue;
+    file.unsetf(std::ios::boolalpha);
+}
+
+
+void SJR::writeInt(std::ofstream &file)
+{
+    if (type == Type::UINT64)
+    {
+        file << uintValue;
+    }
+    else
+    {
+        file << intValue;
+    }
+}
+
+
+//  Shortest text that reads back to exactly the stored value.
+//
+void SJR::writeFloat(std::ofstream &file)
+{
+    char buffer[32];
+    auto result = type == Type::FLOAT
+                  ? std::to_chars(buffer, buffer + sizeof(buffer), static_cast<float>(doubleValue))
+                  : std::to_chars(buffer, buffer + sizeof(buffer), doubleValue);
+
+    file.write(buffer, result.ptr - buffer);
+}
+
+
+void SJR::writeString(std::ofstream &file)
+{
+    file << "\"";
+    writeEscaped(file, stringData, count);
+    file << "\"";
+}
+
+
+void SJR::writeArray(std::ofstream &file)
+{
+    file << '[';
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        arrayData[i].write(file);
+
+        if (i + 1 != count)
+        {
+            file << ',' << ' ';
+        }
+    }
+
+    file << ']';
+}
+
+
+void SJR::writeObject(std::ofstream &file)
+{
+    static int tabsCount;
+
+    file << '\n';
+    SJR::writeTabs(file, tabsCount);
+    file << '{' << '\n';
+
+    ++tabsCount;
+    SJR::writeTabs(file, tabsCount);
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        file << "\"";
+        writeEscaped(file, objectData[i].key, objectData[i].keyLength);
+        file << "\"";
+        file << ": ";
+
+        objectData[i].value.write(file);
+
+        if (i + 1 != count)
+        {
+            file << ", ";
+            file << '\n';
+            SJR::writeTabs(file, tabsCount);
+        }
+    }
+
+    --tabsCount;
+
+    file << '\n';
+
+    SJR::writeTabs(file, tabsCount);
+
+    file << '}';
+
+}
+
+
+void SJR::write(std::ofstream& file)
+{
+    switch (type)
+    {
+        case Type::BOOL :
+            writeBool(file);
+            break;
+
+        case Type::INT:
+        case Type::INT64:
+        case Type::UINT64:
+            writeInt(file);
+            break;
+
+        case Type::FLOAT :
+        case Type::DOUBLE:
+            writeFloat(file);
+            break;
+
+        case Type::STRING:
+            writeString(file);
+            break;
+
+        case Type::ARRAY:
+            writeArray(file);
+            break;
+
+        case Type::OBJECT:
+            writeObject(file);
+            break;
+    }
+
+
+}
+
+
+//  Handler that builds the tree. Every value goes into the root or into the
+//  slot its container opens for it; containers never move while they are
+//  open, because a container only grows once every child after it has been
+//  closed. With an arena, strings are borrowed from the buffer the arena's
+//  owner keeps, and with a key table every key is its interned copy.
+//
+struct SJR::TreeBuilder
+{
+    Arena* arena;
+    std::vector<SJR*>& containers;
+    SJR* node;
+    KeyTable* keys = nullptr;
+
+    SJR& slot()
+    {
+        if (containers.empty() || containers.back()->type == Type::OBJECT)
+        {
+            return *node;
+        }
+
+        return containers.back()->emplaceChild(arena);
+    }
+
+    void startObject()
+    {
+        SJR& value = slot();
+        value.type = Type::OBJECT;
+        containers.push_back(&value);
+    }
+
+    void startArray()
+    {
+        SJR& value = slot();
+        value.type = Type::ARRAY;
+        containers.push_back(&value);
+    }
+
+    //  A repeated key replaces the value it had, as assigning to it would.
+    //  Keys of a Document are views into its buffer; interned keys of an
+    //  owned tree are shared by every member that has them.
+    //
+    void key(std::string_view nodeName)
+    {
+        std::string_view name = nodeName;
+        KeyStorage storage = arena ? KeyStorage::BORROWED : KeyStorage::OWNED;
+
+        if (keys != nullptr)
+        {
+            name = arena ? keys->intern(nodeName) : keys->share(nodeName);
+            storage = arena ? KeyStorage::BORROWED : KeyStorage::SHARED;
+        }
+
+        node = &containers.back()->placeMember(name, arena, storage);
+        node->release();
+    }
+
+    void string(std::string_view string)
+    {
+        if (arena != nullptr)
+        {
+            slot().borrowString(string.data(), string.size());
+        }
+        else
+        {
+            slot().assignString(string.data(), string.size());
+        }
+    }
+
+    void integer(int64_t integer)
+    {
+        SJR& value = slot();
+        bool isInt = integer >= std::numeric_limits<int>::min() && integer <= std::numeric_limits<int>::max();
+
+        value.type = isInt ? Type::INT : Type::INT64;
+        value.intValue = integer;
+    }
+
+    void unsignedInteger(uint64_t integer)
+    {
+        SJR& value = slot();
+        value.type = Type::UINT64;
+        value.uintValue = integer;
+    }
+
+    void real(double real)
+    {
+        SJR& value = slot();
+        value.type = Type::DOUBLE;
+        value.doubleValue = real;
+    }
+
+    void boolean(bool boolean)
+    {
+        SJR& value = slot();
+        value.type = Type::BOOL;
+        value.boolValue = boolean;
+    }
+
+    void end()
+    {
+        containers.pop_back();
+    }
+};
+
+
+//  data must be followed by paddingSize zero bytes.
+//
+void SJR::parseBuffer(char* data, size_t size, const ParseOptions& options, Arena* arena, KeyTable* keys)
+{
+    std::vector<SJR*> containers;
+    std::vector<uint32_t> levels;
+    TreeBuilder builder{arena, containers, this, keys};
+
+    release();
+
+    if (!emitBuffer(data, size, builder, options, levels))
+    {
+        throw std::runtime_error("File doesn't correspong to json format file.");
+    }
+}
+
+
+[[nodiscard]]
+bool SJR::parseBool(char*& file)
+{
+    bool resultTrue = *file == 't' && memcmp(file, "true", 4) == 0;
+    bool resultFalse = *file == 'f' && memcmp(file, "false", 5) == 0;
+
+    if (resultTrue || resultFalse)
+    {
+        boolValue = resultTrue;
+        file += resultTrue ? 4 : 5;
+        type = Type::BOOL;
+        return true;
+    }
+
+    return false;
+}
+
+
+[[nodiscard]]
+bool SJR::parseNumber(char*& file)
+{
+    Number number;
+
+    if (!scanNumber(file, number))
+    {
+        return false;
+    }
+
+    type = numberType(number);
+
+    switch (type)
+    {
+        case Type::INT:
+        case Type::INT64:
+            intValue = number.negative ? static_cast<int64_t>(0 - number.magnitude)
+                                       : static_cast<int64_t>(number.magnitude);
+            break;
+
+        case Type::UINT64:
+            uintValue = number.magnitude;
+            break;
+
+        default:
+            doubleValue = number.real;
+            break;
+    }
+
+    return true;
+}
+
+
+[[nodiscard]]
+bool SJR::parseString(char*& file, Arena* arena)
+{
+    if (*file == '"')
+    {
+        char* contentEnd;
+        char* end = scanString(file + 1, contentEnd);
+
+        if (end == nullptr)
+        {
+            return false;
+        }
+
+        size_t length = contentEnd - file - 1;
+
+        if (arena != nullptr)
+        {
+            borrowString(file + 1, length);
+        }
+        else
+        {
+            assignString(file + 1, length, arena);
+        }
+
+        file = end + 1;
+
+        return true;
+    }
+
+    return false;
+}
+
+
+[[nodiscard]]
+bool SJR::parseKey(char*& file, std::string_view& nodeName)
+{
+    char* contentEnd;
+    char* end = scanString(file + 1, contentEnd);
+
+    if (end == nullptr)
+    {
+        return false;
+    }
+
+    nodeName = std::string_view(file + 1, contentEnd - file - 1);
+    file = end + 1;
+
+    return true;
+}
+
+
+//      ====================      ====================
+//      ====================BUFFER====================
+//      ====================      ====================
+
+
+SJR::PaddedBuffer::PaddedBuffer(size_t size)
+{
+    allocate(size);
+}
+
+
+SJR::PaddedBuffer::PaddedBuffer(std::string_view json)
+{
+    allocate(json.size());
+    memcpy(bytes, json.data(), json.size());
+}
+
+
+SJR::PaddedBuffer::PaddedBuffer(PaddedBuffer&& other) noexcept
+    : bytes(other.bytes), length(other.length), mappedLength(other.mappedLength)
+{
+    other.bytes = nullptr;
+    other.length = 0;
+    other.mappedLength = 0;
+}
+
+
+SJR::PaddedBuffer::~PaddedBuffer()
+{
+    release();
+}
+
+
+SJR::PaddedBuffer& SJR::PaddedBuffer::operator= (PaddedBuffer&& other) noexcept
+{
+    if (this != &other)
+    {
+        release();
+
+        bytes = other.bytes;
+        length = other.length;
+        mappedLength = other.mappedLength;
+
+        other.bytes = nullptr;
+        other.length = 0;
+        other.mappedLength = 0;
+    }
+
+    return *this;
+}
+
+
+void SJR::PaddedBuffer::load(std::string_view filename)
+{
+    release();
+
+#if defined(__unix__) || defined(__APPLE__)
+    int descriptor = open(std::string(filename).c_str(), O_RDONLY);
+    struct stat status;
+
+    if (descriptor == -1 || fstat(descriptor, &status) != 0 || S_ISDIR(status.st_mode))
+    {
+        if (descriptor != -1)
+        {
+            close(descriptor);
+        }
+
+        throw std::runtime_error("File cannot be opened.");
+    }
+
+    size_t fileSize = static_cast<size_t>(status.st_size);
+
+    if (S_ISREG(status.st_mode) && fileSize >= mapThreshold)
+    {
+        size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        size_t reserved = (fileSize + paddingSize + pageSize - 1) & ~(pageSize - 1);
+
+        void* region = mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (region != MAP_FAILED)
+        {
+            void* file = mmap(region, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, descriptor, 0);
+
+            if (file != MAP_FAILED)
+            {
+                madvise(file, fileSize, MADV_SEQUENTIAL);
+                close(descriptor);
+
+                bytes = static_cast<char*>(region);
+                length = fileSize;
+                mappedLength = reserved;
+
+                return;
+            }
+
+            munmap(region, reserved);
+        }
+    }
+
+    close(descriptor);
+#endif
+
+    read(filename);
+}
+
+
+//  Shrinking moves the padding down over the end of the payload; growing
+//  moves the payload to a larger block and leaves the new bytes to fill.
+//
+void SJR::PaddedBuffer::resize(size_t size)
+{
+    if (size > length)
+    {
+        PaddedBuffer old(std::move(*this));
+
+        allocate(size);
+
+        if (old.bytes != nullptr)
+        {
+            memcpy(bytes, old.bytes, old.length);
+        }
+
+        return;
+    }
+
+    length = size;
+
+    if (bytes != nullptr)
+    {
+        memset(bytes + size, 0, paddingSize);
+    }
+}
+
+
+[[nodiscard]]
+char* SJR::PaddedBuffer::data()
+{
+    return bytes;
+}
+
+
+[[nodiscard]]
+size_t SJR::PaddedBuffer::size() const
+{
+    return length;
+}
+
+
+void SJR::PaddedBuffer::release()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    if (mappedLength != 0)
+    {
+        munmap(bytes, mappedLength);
+    }
+    else
+#endif
+    {
+        delete[] bytes;
+    }
+
+    bytes = nullptr;
+    length = 0;
+    mappedLength = 0;
+}
+
+
+//  Whole file in one read, rather than a byte at a time through a stream
+//  iterator.
+//
+void SJR::PaddedBuffer::read(std::string_view filename)
+{
+    std::ifstream file(std::string(filename), std::ios::binary);
+
+    file.seekg(0, std::ios::end);
+    std::streamoff fileSize = file.tellg();
+    file.seekg(0, std::ios::beg);
+
+    if (!file.is_open() || fileSize < 0)
+    {
+        throw std::runtime_error("File cannot be opened.");
+    }
+
+    allocate(static_cast<size_t>(fileSize));
+
+    file.read(bytes, fileSize);
+    length = static_cast<size_t>(file.gcount());
+
+    memset(bytes + length, 0, paddingSize);
+}
+
+
+void SJR::PaddedBuffer::allocate(size_t size)
+{
+    bytes = new char[size + paddingSize];
+    length = size;
+
+    memset(bytes + size, 0, paddingSize);
+}
+
+
+//      ====================        ====================
+//      ====================DOCUMENT====================
+//      ====================        ====================
+
+
+SJR::Arena::~Arena()
+{
+    while (chunks != nullptr)
+    {
+        Chunk* previous = chunks->previous;
+        ::operator delete(chunks);
+        chunks = previous;
+    }
+}
+
+
+//  Every allocation is rounded up to eight bytes, which suits both nodes and
+//  strings. Chunks double in size, so a document needs few of them.
+//
+[[nodiscard]]
+void* SJR::Arena::allocate(size_t bytes)
+{
+    bytes = (bytes + 7) & ~size_t{7};
+
+    if (static_cast<size_t>(end - current) < bytes)
+    {
+        size_t size = chunks ? chunks->size * 2 : minimumChunkSize;
+
+        while (size < bytes + sizeof(Chunk))
+        {
+            size *= 2;
+        }
+
+        Chunk* chunk = static_cast<Chunk*>(::operator new(size));
+        chunk->previous = chunks;
+        chunk->size = size;
+
+        chunks = chunk;
+        current = reinterpret_cast<char*>(chunk + 1);
+        end = reinterpret_cast<char*>(chunk) + size;
+    }
+
+    void* result = current;
+    current += bytes;
+
+    return result;
+}
+
+
+//  Keeps only the newest, largest chunk for reuse.
+//
+void SJR::Arena::reset()
+{
+    if (chunks == nullptr)
+    {
+        return;
+    }
+
+    Chunk* previous = chunks->previous;
+
+    while (previous != nullptr)
+    {
+        Chunk* next = previous->previous;
+        ::operator delete(previous);
+        previous = next;
+    }
+
+    chunks->previous = nullptr;
+    current = reinterpret_cast<char*>(chunks + 1);
+}
+
+
+void SJR::Document::load(std::string_view filename)
+{
+    load(filename, ParseOptions{});
+}
+
+
+void SJR::Document::load(std::string_view filename, const ParseOptions& options)
+{
+    clear();
+
+    buffer.load(filename);
+    rootNode.parseBuffer(buffer.data(), buffer.size(), options, &arena, options.internKeys ? &keys : nullptr);
+}
+
+
+void SJR::Document::parse(std::string_view json)
+{
+    parse(PaddedBuffer(json), ParseOptions{});
+}
+
+
+void SJR::Document::parse(std::string_view json, const ParseOptions& options)
+{
+    parse(PaddedBuffer(json), options);
+}
+
+
+void SJR::Document::parse(PaddedBuffer&& json)
+{
+    parse(std::move(json), ParseOptions{});
+}
+
+
+//  The document takes the buffer over, since its strings stay views into it.
+//
+void SJR::Document::parse(PaddedBuffer&& json, const ParseOptions& options)
+{
+    clear();
+
+    buffer = std::move(json);
+    rootNode.parseBuffer(buffer.data(), buffer.size(), options, &arena, options.internKeys ? &keys : nullptr);
+}
+
+
+void SJR::Document::clear()
+{
+    rootNode.release();
+    arena.reset();
+    keys.clear();
+}
+
+
+[[nodiscard]]
+SJR& SJR::Document::root()
+{
+    return rootNode;
+}
+
+
+[[nodiscard]]
+const SJR& SJR::Document::root() const
+{
+    return rootNode;
+}
+
+
+[[nodiscard]]
+std::string_view SJR::Document::key(std::string_view nodeName) const
+{
+    std::string_view interned = keys.find(nodeName);
+
+    return interned.data() ? interned : nodeName;
+}
+
+
+SJR::KeyTable::~KeyTable()
+{
+    clear();
+}
+
+
+//  The keys are views into the buffer being parsed, which stay valid because
+//  the buffer is only ever decoded in place.
+//
+[[nodiscard]]
+std::string_view SJR::KeyTable::intern(std::string_view key)
+{
+    if (2 * (count + 1) > slots.size())
+    {
+        grow();
+    }
+
+    std::string_view& slot = slots[probe(key)];
+
+    if (slot.data() == nullptr)
+    {
+        slot = key;
+        ++count;
+    }
+
+    return slot;
+}
+
+
+[[nodiscard]]
+std::string_view SJR::KeyTable::share(std::string_view key)
+{
+    if (2 * (count + 1) > slots.size())
+    {
+        grow();
+    }
+
+    std::string_view& slot = slots[probe(key)];
+
+    if (slot.data() == nullptr)
+    {
+        slot = std::string_view(shareKey(key), key.size());
+        shared = true;
+        ++count;
+    }
+
+    return slot;
+}
+
+
+//  Returns a view with no data when key was never interned.
+//
+[[nodiscard]]
+std::string_view SJR::KeyTable::find(std::string_view key) const
+{
+    return slots.empty() ? std::string_view() : slots[probe(key)];
+}
+
+
+void SJR::KeyTable::clear()
+{
+    if (shared)
+    {
+        for (std::string_view key : slots)
+        {
+            if (key.data() != nullptr)
+            {
+                releaseKey(const_cast<char*>(key.data()));
+            }
+        }
+    }
+
+    slots.clear();
+    count = 0;
+    shared = false;
+}
+
+
+//  Returns the slot holding key, or the empty slot it would go in. The table
+//  is kept at most half full, so probe runs stay short.
+//
+[[nodiscard]]
+size_t SJR::KeyTable::probe(std::string_view key) const
+{
+    size_t mask = slots.size() - 1;
+    size_t slot = hashKey(key) & mask;
+
+    while (slots[slot].data() != nullptr && slots[slot] != key)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+
+void SJR::KeyTable::grow()
+{
+    std::vector<std::string_view> old(slots.empty() ? minimumSize : 2 * slots.size());
+
+    old.swap(slots);
+
+    for (std::string_view key : old)
+    {
+        if (key.data() != nullptr)
+        {
+            slots[probe(key)] = key;
+        }
+    }
+}
+
+
+//      ====================    ====================
+//      ====================PUSH====================
+//      ====================    ====================
+
+
+SJR::PushParser::PushParser(const ParseOptions& options)
+    : maxDepth(options.maxDepth < ParseOptions::depthLimit ? options.maxDepth : ParseOptions::depthLimit)
+{
+}
+
+
+//  The consumed prefix is dropped only once it is the larger part of the
+//  buffer, so a long token spread over many chunks is not moved every time.
+//
+[[nodiscard]]
+SJR::PushParser::Status SJR::PushParser::feed(const char* data, size_t size)
+{
+    if (status == Status::ERROR || status == Status::DONE)
+    {
+        return status;
+    }
+
+    if (status == Status::DOCUMENT_READY)
+    {
+        startDocument();
+    }
+
+    if (position > available / 2)
+    {
+        pending.erase(0, position);
+        available -= position;
+        scanned -= position;
+        complete -= position;
+        position = 0;
+    }
+
+    pending.resize(available);
+
+    if (size != 0)
+    {
+        pending.append(data, size);
+        available += size;
+    }
+
+    scan();
+    pending.append(paddingSize, '\0');
+
+    status = run();
+
+    return status;
+}
+
+
+[[nodiscard]]
+SJR::PushParser::Status SJR::PushParser::finish()
+{
+    if (status == Status::ERROR || status == Status::DONE)
+    {
+        return status;
+    }
+
+    char* file = pending.data() + position;
+    skipWhiteSpace(file);
+
+    if (file >= pending.data() + available && (status == Status::DOCUMENT_READY || containers.empty()))
+    {
+        status = Status::DONE;
+        return status;
+    }
+
+    if (status == Status::DOCUMENT_READY)
+    {
+        startDocument();
+    }
+
+    finished = true;
+    status = run();
+
+    //  Input ended inside a document.
+    if (status == Status::NEED_MORE)
+    {
+        status = Status::ERROR;
+    }
+
+    return status;
+}
+
+
+void SJR::PushParser::reset()
+{
+    pending.clear();
+    available = 0;
+    position = 0;
+    scanned = 0;
+    complete = 0;
+    inString = false;
+    escaped = false;
+    finished = false;
+    status = Status::NEED_MORE;
+
+    startDocument();
+}
+
+
+[[nodiscard]]
+SJR& SJR::PushParser::root()
+{
+    return rootNode;
+}
+
+
+void SJR::PushParser::startDocument()
+{
+    containers.clear();
+    rootNode.release();
+    node = &rootNode;
+    state = State::VALUE;
+    status = Status::NEED_MORE;
+}
+
+
+//  Follows the string state over the new bytes, so that a string is only
+//  parsed once its closing quote has arrived.
+//
+void SJR::PushParser::scan()
+{
+    for (; scanned < available; ++scanned)
+    {
+        char c = pending[scanned];
+
+        if (escaped)
+        {
+            escaped = false;
+        }
+        else if (c == '"')
+        {
+            inString = !inString;
+        }
+        else if (c == '\\')
+        {
+            escaped = inString;
+        }
+
+        if (!inString)
+        {
+            complete = scanned + 1;
+        }
+    }
+}
+
+
+//  A number or literal ends at the first byte that cannot continue it; until
+//  that byte has arrived, more digits may still follow.
+//
+[[nodiscard]]
+bool SJR::PushParser::isScalarComplete(const char* file) const
+{
+    const char* end = pending.data() + available;
+
+    while (file < end && *file != '\0' && !isWhiteSpace(*file) && !isOperator(*file) && *file != '"')
+    {
+        ++file;
+    }
+
+    return finished || file < end;
+}
+
+
+//  The same steps as emitEvents, one token at a time: a step either consumes
+//  a whole token or stops without touching the input.
+//
+[[nodiscard]]
+SJR::PushParser::Status SJR::PushParser::run()
+{
+    char* data = pending.data();
+
+    while (true)
+    {
+        char* file = data + position;
+        skipWhiteSpace(file);
+        position = file - data;
+
+        if (position >= complete)
+        {
+            return Status::NEED_MORE;
+        }
+
+        switch (state)
+        {
+            case State::VALUE:
+                switch (classify(*file))
+                {
+                    case CharClass::QUOTE:
+                        if (!node->parseString(file, nullptr))
+                        {
+                            return Status::ERROR;
+                        }
+
+                        break;
+
+                    case CharClass::LITERAL:
+                        if (!isScalarComplete(file))
+                        {
+                            return Status::NEED_MORE;
+                        }
+
+                        if (!node->parseBool(file))
+                        {
+                            return Status::ERROR;
+                        }
+
+                        break;
+
+                    case CharClass::DIGIT:
+                    case CharClass::SIGN:
+                        if (!isScalarComplete(file))
+                        {
+                            return Status::NEED_MORE;
+                        }
+
+                        if (!node->parseNumber(file))
+                        {
+                            return Status::ERROR;
+                        }
+
+                        break;
+
+                    case CharClass::ARRAY_BEGIN:
+                    case CharClass::OBJECT_BEGIN:
+                        if (containers.size() >= maxDepth)
+                        {
+                            return Status::ERROR;
+                        }
+
+                        node->type = *file == '{' ? Type::OBJECT : Type::ARRAY;
+                        containers.push_back(node);
+                        position = file + 1 - data;
+                        state = State::OPENED;
+                        continue;
+
+                    default:
+                        return Status::ERROR;
+                }
+
+                break;
+
+            case State::OPENED:
+            {
+                SJR* container = containers.back();
+                bool isObject = container->type == Type::OBJECT;
+
+                if (*file == (isObject ? '}' : ']'))
+                {
+                    ++file;
+                    containers.pop_back();
+                    break;
+                }
+
+                if (isObject)
+                {
+                    state = State::MEMBER;
+                }
+                else
+                {
+                    node = &container->emplaceChild();
+                    state = State::VALUE;
+                }
+
+                continue;
+            }
+
+            case State::MEMBER:
+            {
+                std::string_view nodeName;
+
+                if (*file != '"' || !parseKey(file, nodeName))
+                {
+                    return Status::ERROR;
+                }
+
+                node = &containers.back()->placeMember(nodeName);
+                node->release();
+                position = file - data;
+                state = State::COLON;
+                continue;
+            }
+
+            case State::COLON:
+                if (*file != ':')
+                {
+                    return Status::ERROR;
+                }
+
+                position = file + 1 - data;
+                state = State::VALUE;
+                continue;
+
+            case State::NEXT:
+            {
+                SJR* container = containers.back();
+                bool isObject = container->type == Type::OBJECT;
+
+                if (*file == ',')
+                {
+                    position = file + 1 - data;
+
+                    if (isObject)
+                    {
+                        state = State::MEMBER;
+                    }
+                    else
+                    {
+                        node = &container->emplaceChild();
+                        state = State::VALUE;
+                    }
+
+                    continue;
+                }
+
+                if (*file != (isObject ? '}' : ']'))
+                {
+                    return Status::ERROR;
+                }
+
+                ++file;
+                containers.pop_back();
+                break;
+            }
+        }
+
+        //  A value is complete, either a scalar or a container just closed.
+        //
+        position = file - data;
+        state = State::NEXT;
+
+        if (containers.empty())
+        {
+            state = State::VALUE;
+            return Status::DOCUMENT_READY;
+        }
+    }
+}
+
+
+//      ====================     ====================
+//      ====================LINES====================
+//      ====================     ====================
+
+
+SJR::LineReader::LineReader(const ParseOptions& options)
+    : maxDepth(options.maxDepth < ParseOptions::depthLimit ? options.maxDepth : ParseOptions::depthLimit),
+      projection(options.projection)
+{
+}
+
+
+void SJR::LineReader::load(std::string_view filename)
+{
+    buffer.load(filename);
+    position = 0;
+}
+
+
+void SJR::LineReader::parse(std::string_view json)
+{
+    parse(PaddedBuffer(json));
+}
+
+
+void SJR::LineReader::parse(PaddedBuffer&& json)
+{
+    buffer = std::move(json);
+    position = 0;
+}
+
+
+//  The newline ending a record is overwritten with a zero byte, so the
+//  record is parsed exactly like a padded buffer of its own.
+//
+[[nodiscard]]
+bool SJR::LineReader::next()
+{
+    char* data = buffer.data();
+    size_t size = buffer.size();
+
+    rootNode.release();
+    arena.reset();
+
+    while (position < size)
+    {
+        char* line = data + position;
+        char* end = static_cast<char*>(memchr(line, '\n', size - position));
+
+        if (end == nullptr)
+        {
+            end = data + size;
+        }
+
+        *end = '\0';
+        position = end + 1 - data;
+
+        ByteCursor cursor{line};
+        TreeBuilder builder{&arena, containers, &rootNode};
+
+        if (*cursor.peek() == '\0')
+        {
+            continue;
+        }
+
+        if (!emitEvents(cursor, builder, maxDepth, projection, levels) || *cursor.peek() != '\0')
+        {
+            rootNode.release();
+            arena.reset();
+
+            throw std::runtime_error("File doesn't correspong to json format file.");
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+
+[[nodiscard]]
+SJR& SJR::LineReader::root()
+{
+    return rootNode;
+}
+
+
+//      ====================    ====================
+//      ====================TAPE====================
+//      ====================    ====================
+
+
+SJR::Tape::Tape()
+{
+    clear();
+}
+
+
+void SJR::Tape::load(std::string_view filename)
+{
+    PaddedBuffer buffer;
+    buffer.load(filename);
+
+    parse(buffer);
+}
+
+
+void SJR::Tape::parse(std::string_view json)
+{
+    PaddedBuffer buffer(json);
+
+    parse(buffer);
+}
+
+
+void SJR::Tape::parse(PaddedBuffer& buffer)
+{
+    if (!build(buffer.data()))
+    {
+        clear();
+
+        throw std::runtime_error("File doesn't correspong to json format file.");
+    }
+}
+
+
+[[nodiscard]]
+SJR::TapeView SJR::Tape::root() const
+{
+    return TapeView(this, 0);
+}
+
+
+void SJR::Tape::clear()
+{
+    entries.clear();
+    strings.clear();
+
+    appendEntry(static_cast<uint64_t>(Type::OBJECT), 1);
+    appendEntry(OBJECT_END, 0);
+}
+
+
+void SJR::Tape::appendEntry(uint64_t tag, uint64_t payload)
+{
+    entries.push_back(tag << 56 | payload);
+}
+
+
+//  Strings are stored as a 32-bit length, the bytes and a terminating zero.
+//
+void SJR::Tape::appendString(std::string_view string)
+{
+    uint32_t length = static_cast<uint32_t>(string.size());
+
+    appendEntry(static_cast<uint64_t>(Type::STRING), strings.size());
+
+    strings.append(reinterpret_cast<const char*>(&length), sizeof(length));
+    strings.append(string);
+    strings.push_back('\0');
+}
+
+
+//  Handler that writes the tape. It is written in document order, so only
+//  the containers that are still open are kept, to count their children and
+//  patch their end entries. An end entry past the 32 bits a container has
+//  for it fails the build.
+//
+struct SJR::Tape::Builder
+{
+    Tape& tape;
+    std::vector<size_t> containers;
+    bool overflow = false;
+
+    void countValue()
+    {
+        if (!containers.empty())
+        {
+            uint64_t& entry = tape.entries[containers.back()];
+
+            if ((entry >> 32 & MAX_COUNT) != MAX_COUNT)
+            {
+                entry += uint64_t{1} << 32;
+            }
+        }
+    }
+
+    void startContainer(Type type)
+    {
+        countValue();
+        containers.push_back(tape.entries.size());
+        tape.appendEntry(static_cast<uint64_t>(type), 0);
+    }
+
+    void startObject()
+    {
+        startContainer(Type::OBJECT);
+    }
+
+    void startArray()
+    {
+        startContainer(Type::ARRAY);
+    }
+
+    void key(std::string_view nodeName)
+    {
+        tape.appendString(nodeName);
+    }
+
+    void string(std::string_view string)
+    {
+        countValue();
+        tape.appendString(string);
+    }
+
+    void integer(int64_t integer)
+    {
+        bool isInt = integer >= std::numeric_limits<int>::min() && integer <= std::numeric_limits<int>::max();
+
+        countValue();
+        tape.appendEntry(static_cast<uint64_t>(isInt ? Type::INT : Type::INT64), 0);
+        tape.entries.push_back(static_cast<uint64_t>(integer));
+    }
+
+    void unsignedInteger(uint64_t integer)
+    {
+        countValue();
+        tape.appendEntry(static_cast<uint64_t>(Type::UINT64), 0);
+        tape.entries.push_back(integer);
+    }
+
+    void real(double real)
+    {
+        uint64_t bits;
+        memcpy(&bits, &real, sizeof(bits));
+
+        countValue();
+        tape.appendEntry(static_cast<uint64_t>(Type::DOUBLE), 0);
+        tape.entries.push_back(bits);
+    }
+
+    void boolean(bool boolean)
+    {
+        countValue();
+        tape.appendEntry(static_cast<uint64_t>(Type::BOOL), boolean);
+    }
+
+    void end()
+    {
+        size_t start = containers.back();
+        bool isObject = tape.entries[start] >> 56 == static_cast<uint64_t>(Type::OBJECT);
+
+        overflow |= tape.entries.size() > UINT32_MAX;
+
+        tape.entries[start] |= tape.entries.size() & UINT32_MAX;
+        tape.appendEntry(isObject ? OBJECT_END : ARRAY_END, start);
+        containers.pop_back();
+    }
+};
+
+
+[[nodiscard]]
+bool SJR::Tape::build(char* file)
+{
+    Builder builder{*this, {}};
+    ByteCursor cursor{file};
+    std::vector<uint32_t> containers;
+
+    entries.clear();
+    strings.clear();
+
+    return emitEvents(cursor, builder, std::numeric_limits<size_t>::max(), nullptr, containers) &&
+           *cursor.peek() == '\0' && !builder.overflow;
+}
+
+
+SJR::TapeView::TapeView(const Tape* tape, size_t index)
+    : tape(tape), index(index)
+{
+}
+
+
+[[nodiscard]]
+SJR::Type SJR::TapeView::getType() const
+{
+    return static_cast<Type>(tape->entries[index] >> 56);
+}
+
+
+[[nodiscard]]
+size_t SJR::TapeView::getChildCount() const
+{
+    return getType() == Type::OBJECT ? countChildren() : 0;
+}
+
+
+[[nodiscard]]
+size_t SJR::TapeView::getArraySize() const
+{
+    return getType() == Type::ARRAY ? countChildren() : 0;
+}
+
+
+//  A missing node cannot be created in a read-only tape. Of duplicated keys
+//  the last wins, as in SJR.
+//
+SJR::TapeView SJR::TapeView::operator[] (std::string_view nodeName) const
+{
+    size_t found = 0;
+
+    if (getType() == Type::OBJECT)
+    {
+        size_t end = payload() & UINT32_MAX;
+
+        for (size_t member = index + 1; member < end; member = TapeView(tape, member + 1).next())
+        {
+            if (TapeView(tape, member).string() == nodeName)
+            {
+                found = member + 1;
+            }
+        }
+    }
+
+    if (found == 0)
+    {
+        throw std::out_of_range("No such node.");
+    }
+
+    return TapeView(tape, found);
+}
+
+
+//  Indexing starts with 0.
+//
+SJR::TapeView SJR::TapeView::operator[] (size_t index) const
+{
+    if (getType() == Type::ARRAY)
+    {
+        size_t end = payload() & UINT32_MAX;
+        size_t element = this->index + 1;
+
+        for (; index > 0 && element < end; --index)
+        {
+            element = TapeView(tape, element).next();
+        }
+
+        if (element < end)
+        {
+            return TapeView(tape, element);
+        }
+    }
+
+    throw std::out_of_range("No such node.");
+}
+
+
+[[nodiscard]]
+uint64_t SJR::TapeView::payload() const
+{
+    return tape->entries[index] & ((uint64_t{1} << 56) - 1);
+}
+
+
+[[nodiscard]]
+uint64_t SJR::TapeView::word() const
+{
+    return tape->entries[index + 1];
+}
+
+
+[[nodiscard]]
+std::string_view SJR::TapeView::string() const
+{
+    const char* data = tape->strings.data() + payload();
+    uint32_t length;
+
+    memcpy(&length, data, sizeof(length));
+
+    return std::string_view(data + sizeof(length), length);
+}
+
+
+//  Counts past MAX_COUNT are recovered by walking the children. Repeated keys
+//  are each counted, unlike in SJR: the tape keeps every member as written.
+//
+[[nodiscard]]
+size_t SJR::TapeView::countChildren() const
+{
+    size_t count = payload() >> 32;
+
+    if (count < Tape::MAX_COUNT)
+    {
+        return count;
+    }
+
+    size_t end = payload() & UINT32_MAX;
+    bool isObject = getType() == Type::OBJECT;
+
+    count = 0;
+
+    for (size_t child = index + 1; child < end; child = TapeView(tape, child + isObject).next())
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+
+//  Tape index just past this value.
+//
+[[nodiscard]]
+size_t SJR::TapeView::next() const
+{
+    switch (getType())
+    {
+        case Type::ARRAY:
+        case Type::OBJECT:
+            return (payload() & UINT32_MAX) + 1;
+
+        case Type::INT:
+        case Type::INT64:
+        case Type::UINT64:
+        case Type::DOUBLE:
+            return index + 2;
 
-void SJR::writeBool(std::ofstream& file)
-{
-    file.setf(std::ios_base::boolalpha);
-    file << static_cast<bool>(std::stoi(value));
-    file.unsetf(std::ios::boolalpha);
+        default:
+            return index + 1;
+    }
 }
 
 
-void SJR::writeInt(std::ofstream &file)
-{
-    file << std::stoi(value);
-}
+//      ====================    ====================
+//      ====================LAZY====================
+//      ====================    ====================
 
 
-void SJR::writeFloat(std::ofstream &file)
+void SJR::LazyDocument::load(std::string_view filename)
 {
-    file << std::stof(value);
+    buffer.load(filename);
 }
 
 
-void SJR::writeString(std::ofstream &file)
+void SJR::LazyDocument::parse(std::string_view json)
 {
-    file << "\"" << value << "\"";
+    buffer = PaddedBuffer(json);
 }
 
 
-void SJR::writeArray(std::ofstream &file)
+void SJR::LazyDocument::parse(PaddedBuffer&& json)
 {
-    file << '[';
-
-    for (auto it = vectorJson.begin(); it != vectorJson.end(); ++it)
-    {
-        it->write(file);
-
-        if (it != (--vectorJson.end()))
-        {
-            file << ',' << ' ';
-        }
-    }
-
-    file << ']';
+    buffer = std::move(json);
 }
 
 
-void SJR::writeObject(std::ofstream &file)
+//  With nothing loaded the root is an empty object, like a default SJR.
+//
+[[nodiscard]]
+SJR::LazyView SJR::LazyDocument::root()
 {
-    if (!value.empty())
-    {
-        file << "\"" << value << "\"";
-        file << ": ";
-    }
-
-    static int tabsCount;
+    static char emptyObject[paddingSize + 2] = "{}";
+    char* file = buffer.data();
 
-    file << '\n';
-    SJR::writeTabs(file, tabsCount);
-    file << '{' << '\n';
-
-    ++tabsCount;
-    SJR::writeTabs(file, tabsCount);
-
-    for (auto it = mapJson.begin(); it != mapJson.end(); ++it)
+    if (file == nullptr)
     {
-        file << "\"" << it->first << "\"";
-        file << ": ";
-
-        it->second.write(file);
-
-        if (it != (--mapJson.end()))
-        {
-            file << ", ";
-            file << '\n';
-            SJR::writeTabs(file, tabsCount);
-        }
+        return LazyView(emptyObject);
     }
 
-    --tabsCount;
-
-    file << '\n';
+    skipWhiteSpace(file);
 
-    SJR::writeTabs(file, tabsCount);
+    return LazyView(file);
+}
 
-    file << '}';
 
+SJR::LazyView::LazyView(char* value)
+    : value(value)
+{
 }
 
 
-void SJR::write(std::ofstream& file)
+[[nodiscard]]
+SJR::Type SJR::LazyView::getType() const
 {
-    switch (type)
+    switch (classify(*value))
     {
-        case Type::BOOL :
-            writeBool(file);
-            break;
+        case CharClass::QUOTE:
+            return Type::STRING;
 
-        case Type::INT:
-            writeInt(file);
-            break;
+        case CharClass::LITERAL:
+            if (skipValue(value) == nullptr)
+            {
+                break;
+            }
 
-        case Type::FLOAT :
-            writeFloat(file);
-            break;
+            return Type::BOOL;
 
-        case Type::STRING:
-            writeString(file);
-            break;
+        case CharClass::DIGIT:
+        case CharClass::SIGN:
+            return numberType(number());
 
-        case Type::ARRAY:
-            writeArray(file);
-            break;
+        case CharClass::ARRAY_BEGIN:
+            return Type::ARRAY;
 
-        case Type::OBJECT:
-            writeObject(file);
+        case CharClass::OBJECT_BEGIN:
+            return Type::OBJECT;
+
+        default:
             break;
     }
 
-
+    throw std::runtime_error("File doesn't correspong to json format file.");
 }
 
 
 [[nodiscard]]
-bool SJR::parseBool(char*& file)
+size_t SJR::LazyView::getChildCount() const
 {
-    bool resultTrue = memcmp(file, "true", 4) == 0;
-    bool resultFalse = memcmp(file, "false", 5) == 0;
-
-    if (resultTrue || resultFalse)
-    {
-        value = std::to_string(resultTrue);
-        file += resultTrue ? 4 : 5;
-        type = Type::BOOL;
-        return true;
-    }
-
-    return false;
+    return getType() == Type::OBJECT ? countChildren() : 0;
 }
 
 
 [[nodiscard]]
-bool SJR::parseNumber(char*& file)
+size_t SJR::LazyView::getArraySize() const
 {
-    bool signNegative = *file == '-';
-    bool signPositive = *file == '+';
-
-    bool sign = signNegative | signPositive;
+    return getType() == Type::ARRAY ? countChildren() : 0;
+}
 
-    int valueInt{0};
-    float valueFloat{0.0f};
 
-    if (sign || isdigit(*file))
+//  Keys are compared as they are written unless they hold escapes. The walk
+//  stops at the first member with the name: unlike SJR, where the last of
+//  repeated keys wins, reading one member never scans the rest.
+//
+SJR::LazyView SJR::LazyView::operator[] (std::string_view nodeName) const
+{
+    if (*value == '{')
     {
-        if (sign)
-        {
-            ++file;
-        }
-
-        while (isdigit(*file))
-        {
-            valueInt *= 10;
-            valueInt += *file - '0';
-            ++file;
-        }
+        char* file = value + 1;
+        skipWhiteSpace(file);
 
-        if (*file == '.')
+        while (*file != '}')
         {
-            ++file;
-
-            type = Type::FLOAT;
-            valueFloat = static_cast<float>(valueInt);
+            char* keyEnd = *file == '"' ? findStringEnd(file + 1) : nullptr;
 
-	    int shift = 1;
-		
-            while(isdigit(*file))
+            if (keyEnd == nullptr)
             {
-                valueFloat *= pow(10, shift);
-                valueFloat += static_cast<float>(*file - '0');
-                valueFloat /= pow(10, shift);
-
-		++shift;
-                ++file;
+                throw std::runtime_error("File doesn't correspong to json format file.");
             }
 
-            value = std::to_string(valueFloat * (signNegative ? -1. : 1.));
+            std::string_view key(file + 1, keyEnd - file - 1);
+            bool found = key.find('\\') == std::string_view::npos ? key == nodeName
+                                                                     : LazyView(file).string() == nodeName;
 
-            return true;
-        }
+            file = keyEnd + 1;
+            skipWhiteSpace(file);
 
-        if (*file == 'e' || *file == 'E')
-        {
-            ++file;
+            if (*file != ':')
+            {
+                throw std::runtime_error("File doesn't correspong to json format file.");
+            }
 
-            type = Type::FLOAT;
-            valueFloat = static_cast<float>(valueInt);
-            valueInt = 0;
+            ++file;
+            skipWhiteSpace(file);
 
-            while (isdigit(*file))
+            if (found)
             {
-                valueInt *= 10;
-                valueInt += *file - '0';
+                return LazyView(file);
             }
 
-            valueFloat *= static_cast<float>(pow(10, valueInt));
-
-            value = std::to_string(valueFloat * (signNegative ? -1. : 1.));
-            return true;
+            file = nextChild(file, '}');
         }
-
-        type = Type::INT;
-        value = std::to_string(valueInt * (signNegative ? -1 : 1));
-        return true;
     }
 
-    return false;
+    throw std::out_of_range("No such node.");
 }
 
 
-[[nodiscard]]
-bool SJR::parseString(char*& file)
+//  Indexing starts with 0.
+//
+SJR::LazyView SJR::LazyView::operator[] (size_t index) const
 {
-    if (*file == '"')
+    if (*value == '[')
     {
-        ++file;
+        char* file = value + 1;
+        skipWhiteSpace(file);
 
-        type = Type::STRING;
-
-        while (*file != '"')
+        for (; *file != ']'; --index)
         {
-            SJR::skipWhiteSpace(file);
-
-            if (*file == '"')
+            if (index == 0)
             {
-                return true;
+                return LazyView(file);
             }
 
-            value += *file;
-
-            ++file;
+            file = nextChild(file, ']');
         }
+    }
 
-        ++file;
+    throw std::out_of_range("No such node.");
+}
 
-        return true;
+
+[[nodiscard]]
+SJR::Number SJR::LazyView::number() const
+{
+    Number number;
+    char* file = value;
+
+    if (!scanNumber(file, number))
+    {
+        throw std::runtime_error("File doesn't correspong to json format file.");
     }
 
-    return false;
+    return number;
 }
 
 
+//  Decodes into a copy, leaving the text as it is.
+//
 [[nodiscard]]
-bool SJR::parseArray(char*& file)
+std::string SJR::LazyView::string() const
 {
-    if (*file == '[')
-    {
-        ++file;
+    char* file = value + 1;
+    std::string result;
 
-        type = Type::ARRAY;
+    while (true)
+    {
+        char* stop = findStringStop(file);
+        result.append(file, stop - file);
 
-        while (*file != ']')
+        if (*stop == '"')
         {
-            SJR::skipWhiteSpace(file);
+            return result;
+        }
 
-            if (*file == ']')
-            {
-                ++file;
+        char decoded[4];
+        char* out = decoded;
 
-                return true;
-            }
+        file = *stop == '\\' ? decodeEscape(stop, out) : nullptr;
+
+        if (file == nullptr)
+        {
+            throw std::runtime_error("File doesn't correspong to json format file.");
+        }
 
-            SJR newSJR;
+        result.append(decoded, out - decoded);
+    }
+}
 
-            if (!newSJR.parse(file))
-            {
-                return false;
-            }
 
-            vectorJson.push_back(newSJR);
+//  Every member is counted, repeated keys included, since telling them apart
+//  would mean comparing every key with every other.
+//
+[[nodiscard]]
+size_t SJR::LazyView::countChildren() const
+{
+    char close = *value == '{' ? '}' : ']';
+    char* file = value + 1;
+    size_t count = 0;
+
+    skipWhiteSpace(file);
 
-            SJR::skipWhiteSpace(file);
+    while (*file != close)
+    {
+        if (close == '}')
+        {
+            char* keyEnd = *file == '"' ? findStringEnd(file + 1) : nullptr;
 
-            if (*file == ']')
+            if (keyEnd == nullptr)
             {
-                ++file;
-                type = Type::ARRAY;
-                return true;
+                throw std::runtime_error("File doesn't correspong to json format file.");
             }
 
-            if (*file != ',')
+            file = keyEnd + 1;
+            skipWhiteSpace(file);
+
+            if (*file != ':')
             {
-                return false;
+                throw std::runtime_error("File doesn't correspong to json format file.");
             }
 
             ++file;
+            skipWhiteSpace(file);
         }
 
-        ++file;
-        return true;
+        file = nextChild(file, close);
+        ++count;
     }
 
-    return false;
+    return count;
 }
 
 
+//  Steps over the child value at file and its separator, stopping at the
+//  next child or at close.
+//
 [[nodiscard]]
-bool SJR::parseObject(char*& file)
+char* SJR::LazyView::nextChild(char* file, char close)
 {
-    if (*file == '{')
+    file = skipValue(file);
+
+    if (file != nullptr)
     {
-        ++file;
-        type = Type::OBJECT;
+        skipWhiteSpace(file);
 
-        while (*file != '}')
+        if (*file == ',')
         {
-            SJR::skipWhiteSpace(file);
+            ++file;
+            skipWhiteSpace(file);
 
-            if (*file == '}')
+            if (*file != close)
             {
-                ++file;
-                return true;
+                return file;
             }
+        }
+        else if (*file == close)
+        {
+            return file;
+        }
+    }
 
+    throw std::runtime_error("File doesn't correspong to json format file.");
+}
 
-            if (*file == '"')
-            {
-                ++file;
-                std::string nodeName{};
-
-                while (*file != '"')
-                {
-                    SJR::skipWhiteSpace(file);
-
-                    if (*file == '"')
-                    {
-                        break;
-                    }
-
-                    nodeName += *file;
-
-                    ++file;
-                }
-
-                if (*file != '"')
-                {
-                    return true;
-                }
 
-                ++file;
-                SJR::skipWhiteSpace(file);
+//      ====================          ====================
+//      ====================PROJECTION====================
+//      ====================          ====================
 
 
-                if (*file != ':')
-                {
-                    return true;
-                }
+SJR::Projection::Projection(std::initializer_list<std::string_view> paths)
+{
+    for (std::string_view path : paths)
+    {
+        add(path);
+    }
+}
 
-                ++file;
-                SJR::skipWhiteSpace(file);
 
-                SJR newNode;
-                if (!newNode.parse(file)) {
-                    return true;
-                }
-                type = Type::OBJECT;
-                mapJson[nodeName] = newNode;
-            }
+//  A path that is a prefix of another keeps the whole value, so the longer
+//  one no longer narrows anything.
+//
+void SJR::Projection::add(std::string_view path)
+{
+    uint32_t node = 0;
 
-            SJR::skipWhiteSpace(file);
+    while (!nodes[node].whole && !path.empty())
+    {
+        size_t separator = path.find('/');
+        std::string_view name = path.substr(0, separator);
+        uint32_t child = NONE;
 
-            if (*file == '}')
-            {
-                ++file;
-                return true;
-            }
+        path = separator == std::string_view::npos ? std::string_view() : path.substr(separator + 1);
 
-            if (*file != ',')
+        for (const auto& [childName, index] : nodes[node].children)
+        {
+            if (childName == name)
             {
-                return false;
+                child = index;
+                break;
             }
+        }
 
-            ++file;
+        if (child == NONE)
+        {
+            child = static_cast<uint32_t>(nodes.size());
+            nodes[node].children.emplace_back(std::string(name), child);
+            nodes.emplace_back();
         }
 
-        ++file;
-        return true;
+        node = child;
     }
 
-    return false;
+    nodes[node].whole = true;
 }
 
 
-//
-//
 [[nodiscard]]
-bool SJR::parse(char*& file)
+uint32_t SJR::Projection::root() const
 {
-    skipWhiteSpace(file);
+    return nodes[0].whole ? ALL : 0;
+}
 
-    if (parseString(file))
-    {
-        return true;
-    }
 
-    if (parseBool(file))
+//  Returns ALL when the child is kept whole and NONE when it is not on any
+//  path. Nodes have few children, so a linear scan is enough.
+//
+[[nodiscard]]
+uint32_t SJR::Projection::find(uint32_t node, std::string_view name) const
+{
+    for (const auto& [childName, index] : nodes[node].children)
     {
-        return true;
+        if (childName == name)
+        {
+            return nodes[index].whole ? ALL : index;
+        }
     }
 
-    if (parseNumber(file))
-    {
-        return true;
-    }
+    return NONE;
+}
 
-    if (parseArray(file))
-    {
-        return true;
-    }
 
-    if (parseObject(file))
-    {
-        return true;
-    }
+const double SJR::exactPowersOfTen[23] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
 
-    return false;
-}
+
+//  128-bit truncated mantissas of 5^q (equivalently 10^q) for q in [-342, 308],
+//  most significant word first, as used by computeDouble.
+//
+const uint64_t SJR::powersOfFive[651][2] =
+{
+    {0xeef453d6923bd65a, 0x113faa2906a13b3f},
+    {0x9558b4661b6565f8, 0x4ac7ca59a424c507},
+    {0xbaaee17fa23ebf76, 0x5d79bcf00d2df649},
+    {0xe95a99df8ace6f53, 0xf4d82c2c107973dc},
+    {0x91d8a02bb6c10594, 0x79071b9b8a4be869},
+    {0xb64ec836a47146f9, 0x9748e2826cdee284},
+    {0xe3e27a444d8d98b7, 0xfd1b1b2308169b25},
+    {0x8e6d8c6ab0787f72, 0xfe30f0f5e50e20f7},
+    {0xb208ef855c969f4f, 0xbdbd2d335e51a935},
+    {0xde8b2b66b3bc4723, 0xad2c788035e61382},
+    {0x8b16fb203055ac76, 0x4c3bcb5021afcc31},
+    {0xaddcb9e83c6b1793, 0xdf4abe242a1bbf3d},
+    {0xd953e8624b85dd78, 0xd71d6dad34a2af0d},
+    {0x87d4713d6f33aa6b, 0x8672648c40e5ad68},
+    {0xa9c98d8ccb009506, 0x680efdaf511f18c2},
+    {0xd43bf0effdc0ba48, 0x0212bd1b2566def2},
+    {0x84a57695fe98746d, 0x014bb630f7604b57},
+    {0xa5ced43b7e3e9188, 0x419ea3bd35385e2d},
+    {0xcf42894a5dce35ea, 0x52064cac828675b9},
+    {0x818995ce7aa0e1b2, 0x7343efebd1940993},
+    {0xa1ebfb4219491a1f, 0x1014ebe6c5f90bf8},
+    {0xca66fa129f9b60a6, 0xd41a26e077774ef6},
+    {0xfd00b897478238d0, 0x8920b098955522b4},
+    {0x9e20735e8cb16382, 0x55b46e5f5d5535b0},
+    {0xc5a890362fddbc62, 0xeb2189f734aa831d},
+    {0xf712b443bbd52b7b, 0xa5e9ec7501d523e4},
+    {0x9a6bb0aa55653b2d, 0x47b233c92125366e},
+    {0xc1069cd4eabe89f8, 0x999ec0bb696e840a},
+    {0xf148440a256e2c76, 0xc00670ea43ca250d},
+    {0x96cd2a865764dbca, 0x380406926a5e5728},
+    {0xbc807527ed3e12bc, 0xc605083704f5ecf2},
+    {0xeba09271e88d976b, 0xf7864a44c633682e},
+    {0x93445b8731587ea3, 0x7ab3ee6afbe0211d},
+    {0xb8157268fdae9e4c, 0x5960ea05bad82964},
+    {0xe61acf033d1a45df, 0x6fb92487298e33bd},
+    {0x8fd0c16206306bab, 0xa5d3b6d479f8e056},
+    {0xb3c4f1ba87bc8696, 0x8f48a4899877186c},
+    {0xe0b62e2929aba83c, 0x331acdabfe94de87},
+    {0x8c71dcd9ba0b4925, 0x9ff0c08b7f1d0b14},
+    {0xaf8e5410288e1b6f, 0x07ecf0ae5ee44dd9},
+    {0xdb71e91432b1a24a, 0xc9e82cd9f69d6150},
+    {0x892731ac9faf056e, 0xbe311c083a225cd2},
+    {0xab70fe17c79ac6ca, 0x6dbd630a48aaf406},
+    {0xd64d3d9db981787d, 0x092cbbccdad5b108},
+    {0x85f0468293f0eb4e, 0x25bbf56008c58ea5},
+    {0xa76c582338ed2621, 0xaf2af2b80af6f24e},
+    {0xd1476e2c07286faa, 0x1af5af660db4aee1},
+    {0x82cca4db847945ca, 0x50d98d9fc890ed4d},
+    {0xa37fce126597973c, 0xe50ff107bab528a0},
+    {0xcc5fc196fefd7d0c, 0x1e53ed49a96272c8},
+    {0xff77b1fcbebcdc4f, 0x25e8e89c13bb0f7a},
+    {0x9faacf3df73609b1, 0x77b191618c54e9ac},
+    {0xc795830d75038c1d, 0xd59df5b9ef6a2417},
+    {0xf97ae3d0d2446f25, 0x4b0573286b44ad1d},
+    {0x9becce62836ac577, 0x4ee367f9430aec32},
+    {0xc2e801fb244576d5, 0x229c41f793cda73f},
+    {0xf3a20279ed56d48a, 0x6b43527578c1110f},
+    {0x9845418c345644d6, 0x830a13896b78aaa9},
+    {0xbe5691ef416bd60c, 0x23cc986bc656d553},
+    {0xedec366b11c6cb8f, 0x2cbfbe86b7ec8aa8},
+    {0x94b3a202eb1c3f39, 0x7bf7d71432f3d6a9},
+    {0xb9e08a83a5e34f07, 0xdaf5ccd93fb0cc53},
+    {0xe858ad248f5c22c9, 0xd1b3400f8f9cff68},
+    {0x91376c36d99995be, 0x23100809b9c21fa1},
+    {0xb58547448ffffb2d, 0xabd40a0c2832a78a},
+    {0xe2e69915b3fff9f9, 0x16c90c8f323f516c},
+    {0x8dd01fad907ffc3b, 0xae3da7d97f6792e3},
+    {0xb1442798f49ffb4a, 0x99cd11cfdf41779c},
+    {0xdd95317f31c7fa1d, 0x40405643d711d583},
+    {0x8a7d3eef7f1cfc52, 0x482835ea666b2572},
+    {0xad1c8eab5ee43b66, 0xda3243650005eecf},
+    {0xd863b256369d4a40, 0x90bed43e40076a82},
+    {0x873e4f75e2224e68, 0x5a7744a6e804a291},
+    {0xa90de3535aaae202, 0x711515d0a205cb36},
+    {0xd3515c2831559a83, 0x0d5a5b44ca873e03},
+    {0x8412d9991ed58091, 0xe858790afe9486c2},
+    {0xa5178fff668ae0b6, 0x626e974dbe39a872},
+    {0xce5d73ff402d98e3, 0xfb0a3d212dc8128f},
+    {0x80fa687f881c7f8e, 0x7ce66634bc9d0b99},
+    {0xa139029f6a239f72, 0x1c1fffc1ebc44e80},
+    {0xc987434744ac874e, 0xa327ffb266b56220},
+    {0xfbe9141915d7a922, 0x4bf1ff9f0062baa8},
+    {0x9d71ac8fada6c9b5, 0x6f773fc3603db4a9},
+    {0xc4ce17b399107c22, 0xcb550fb4384d21d3},
+    {0xf6019da07f549b2b, 0x7e2a53a146606a48},
+    {0x99c102844f94e0fb, 0x2eda7444cbfc426d},
+    {0xc0314325637a1939, 0xfa911155fefb5308},
+    {0xf03d93eebc589f88, 0x793555ab7eba27ca},
+    {0x96267c7535b763b5, 0x4bc1558b2f3458de},
+    {0xbbb01b9283253ca2, 0x9eb1aaedfb016f16},
+    {0xea9c227723ee8bcb, 0x465e15a979c1cadc},
+    {0x92a1958a7675175f, 0x0bfacd89ec191ec9},
+    {0xb749faed14125d36, 0xcef980ec671f667b},
+    {0xe51c79a85916f484, 0x82b7e12780e7401a},
+    {0x8f31cc0937ae58d2, 0xd1b2ecb8b0908810},
+    {0xb2fe3f0b8599ef07, 0x861fa7e6dcb4aa15},
+    {0xdfbdcece67006ac9, 0x67a791e093e1d49a},
+    {0x8bd6a141006042bd, 0xe0c8bb2c5c6d24e0},
+    {0xaecc49914078536d, 0x58fae9f773886e18},
+    {0xda7f5bf590966848, 0xaf39a475506a899e},
+    {0x888f99797a5e012d, 0x6d8406c952429603},
+    {0xaab37fd7d8f58178, 0xc8e5087ba6d33b83},
+    {0xd5605fcdcf32e1d6, 0xfb1e4a9a90880a64},
+    {0x855c3be0a17fcd26, 0x5cf2eea09a55067f},
+    {0xa6b34ad8c9dfc06f, 0xf42faa48c0ea481e},
+    {0xd0601d8efc57b08b, 0xf13b94daf124da26},
+    {0x823c12795db6ce57, 0x76c53d08d6b70858},
+    {0xa2cb1717b52481ed, 0x54768c4b0c64ca6e},
+    {0xcb7ddcdda26da268, 0xa9942f5dcf7dfd09},
+    {0xfe5d54150b090b02, 0xd3f93b35435d7c4c},
+    {0x9efa548d26e5a6e1, 0xc47bc5014a1a6daf},
+    {0xc6b8e9b0709f109a, 0x359ab6419ca1091b},
+    {0xf867241c8cc6d4c0, 0xc30163d203c94b62},
+    {0x9b407691d7fc44f8, 0x79e0de63425dcf1d},
+    {0xc21094364dfb5636, 0x985915fc12f542e4},
+    {0xf294b943e17a2bc4, 0x3e6f5b7b17b2939d},
+    {0x979cf3ca6cec5b5a, 0xa705992ceecf9c42},
+    {0xbd8430bd08277231, 0x50c6ff782a838353},
+    {0xece53cec4a314ebd, 0xa4f8bf5635246428},
+    {0x940f4613ae5ed136, 0x871b7795e136be99},
+    {0xb913179899f68584, 0x28e2557b59846e3f},
+    {0xe757dd7ec07426e5, 0x331aeada2fe589cf},
+    {0x9096ea6f3848984f, 0x3ff0d2c85def7621},
+    {0xb4bca50b065abe63, 0x0fed077a756b53a9},
+    {0xe1ebce4dc7f16dfb, 0xd3e8495912c62894},
+    {0x8d3360f09cf6e4bd, 0x64712dd7abbbd95c},
+    {0xb080392cc4349dec, 0xbd8d794d96aacfb3},
+    {0xdca04777f541c567, 0xecf0d7a0fc5583a0},
+    {0x89e42caaf9491b60, 0xf41686c49db57244},
+    {0xac5d37d5b79b6239, 0x311c2875c522ced5},
+    {0xd77485cb25823ac7, 0x7d633293366b828b},
+    {0x86a8d39ef77164bc, 0xae5dff9c02033197},
+    {0xa8530886b54dbdeb, 0xd9f57f830283fdfc},
+    {0xd267caa862a12d66, 0xd072df63c324fd7b},
+    {0x8380dea93da4bc60, 0x4247cb9e59f71e6d},
+    {0xa46116538d0deb78, 0x52d9be85f074e608},
+    {0xcd795be870516656, 0x67902e276c921f8b},
+    {0x806bd9714632dff6, 0x00ba1cd8a3db53b6},
+    {0xa086cfcd97bf97f3, 0x80e8a40eccd228a4},
+    {0xc8a883c0fdaf7df0, 0x6122cd128006b2cd},
+    {0xfad2a4b13d1b5d6c, 0x796b805720085f81},
+    {0x9cc3a6eec6311a63, 0xcbe3303674053bb0},
+    {0xc3f490aa77bd60fc, 0xbedbfc4411068a9c},
+    {0xf4f1b4d515acb93b, 0xee92fb5515482d44},
+    {0x991711052d8bf3c5, 0x751bdd152d4d1c4a},
+    {0xbf5cd54678eef0b6, 0xd262d45a78a0635d},
+    {0xef340a98172aace4, 0x86fb897116c87c34},
+    {0x9580869f0e7aac0e, 0xd45d35e6ae3d4da0},
+    {0xbae0a846d2195712, 0x8974836059cca109},
+    {0xe998d258869facd7, 0x2bd1a438703fc94b},
+    {0x91ff83775423cc06, 0x7b6306a34627ddcf},
+    {0xb67f6455292cbf08, 0x1a3bc84c17b1d542},
+    {0xe41f3d6a7377eeca, 0x20caba5f1d9e4a93},
+    {0x8e938662882af53e, 0x547eb47b7282ee9c},
+    {0xb23867fb2a35b28d, 0xe99e619a4f23aa43},
+    {0xdec681f9f4c31f31, 0x6405fa00e2ec94d4},
+    {0x8b3c113c38f9f37e, 0xde83bc408dd3dd04},
+    {0xae0b158b4738705e, 0x9624ab50b148d445},
+    {0xd98ddaee19068c76, 0x3badd624dd9b0957},
+    {0x87f8a8d4cfa417c9, 0xe54ca5d70a80e5d6},
+    {0xa9f6d30a038d1dbc, 0x5e9fcf4ccd211f4c},
+    {0xd47487cc8470652b, 0x7647c3200069671f},
+    {0x84c8d4dfd2c63f3b, 0x29ecd9f40041e073},
+    {0xa5fb0a17c777cf09, 0xf468107100525890},
+    {0xcf79cc9db955c2cc, 0x7182148d4066eeb4},
+    {0x81ac1fe293d599bf, 0xc6f14cd848405530},
+    {0xa21727db38cb002f, 0xb8ada00e5a506a7c},
+    {0xca9cf1d206fdc03b, 0xa6d90811f0e4851c},
+    {0xfd442e4688bd304a, 0x908f4a166d1da663},
+    {0x9e4a9cec15763e2e, 0x9a598e4e043287fe},
+    {0xc5dd44271ad3cdba, 0x40eff1e1853f29fd},
+    {0xf7549530e188c128, 0xd12bee59e68ef47c},
+    {0x9a94dd3e8cf578b9, 0x82bb74f8301958ce},
+    {0xc13a148e3032d6e7, 0xe36a52363c1faf01},
+    {0xf18899b1bc3f8ca1, 0xdc44e6c3cb279ac1},
+    {0x96f5600f15a7b7e5, 0x29ab103a5ef8c0b9},
+    {0xbcb2b812db11a5de, 0x7415d448f6b6f0e7},
+    {0xebdf661791d60f56, 0x111b495b3464ad21},
+    {0x936b9fcebb25c995, 0xcab10dd900beec34},
+    {0xb84687c269ef3bfb, 0x3d5d514f40eea742},
+    {0xe65829b3046b0afa, 0x0cb4a5a3112a5112},
+    {0x8ff71a0fe2c2e6dc, 0x47f0e785eaba72ab},
+    {0xb3f4e093db73a093, 0x59ed216765690f56},
+    {0xe0f218b8d25088b8, 0x306869c13ec3532c},
+    {0x8c974f7383725573, 0x1e414218c73a13fb},
+    {0xafbd2350644eeacf, 0xe5d1929ef90898fa},
+    {0xdbac6c247d62a583, 0xdf45f746b74abf39},
+    {0x894bc396ce5da772, 0x6b8bba8c328eb783},
+    {0xab9eb47c81f5114f, 0x066ea92f3f326564},
+    {0xd686619ba27255a2, 0xc80a537b0efefebd},
+    {0x8613fd0145877585, 0xbd06742ce95f5f36},
+    {0xa798fc4196e952e7, 0x2c48113823b73704},
+    {0xd17f3b51fca3a7a0, 0xf75a15862ca504c5},
+    {0x82ef85133de648c4, 0x9a984d73dbe722fb},
+    {0xa3ab66580d5fdaf5, 0xc13e60d0d2e0ebba},
+    {0xcc963fee10b7d1b3, 0x318df905079926a8},
+    {0xffbbcfe994e5c61f, 0xfdf17746497f7052},
+    {0x9fd561f1fd0f9bd3, 0xfeb6ea8bedefa633},
+    {0xc7caba6e7c5382c8, 0xfe64a52ee96b8fc0},
+    {0xf9bd690a1b68637b, 0x3dfdce7aa3c673b0},
+    {0x9c1661a651213e2d, 0x06bea10ca65c084e},
+    {0xc31bfa0fe5698db8, 0x486e494fcff30a62},
+    {0xf3e2f893dec3f126, 0x5a89dba3c3efccfa},
+    {0x986ddb5c6b3a76b7, 0xf89629465a75e01c},
+    {0xbe89523386091465, 0xf6bbb397f1135823},
+    {0xee2ba6c0678b597f, 0x746aa07ded582e2c},
+    {0x94db483840b717ef, 0xa8c2a44eb4571cdc},
+    {0xba121a4650e4ddeb, 0x92f34d62616ce413},
+    {0xe896a0d7e51e1566, 0x77b020baf9c81d17},
+    {0x915e2486ef32cd60, 0x0ace1474dc1d122e},
+    {0xb5b5ada8aaff80b8, 0x0d819992132456ba},
+    {0xe3231912d5bf60e6, 0x10e1fff697ed6c69},
+    {0x8df5efabc5979c8f, 0xca8d3ffa1ef463c1},
+    {0xb1736b96b6fd83b3, 0xbd308ff8a6b17cb2},
+    {0xddd0467c64bce4a0, 0xac7cb3f6d05ddbde},
+    {0x8aa22c0dbef60ee4, 0x6bcdf07a423aa96b},
+    {0xad4ab7112eb3929d, 0x86c16c98d2c953c6},
+    {0xd89d64d57a607744, 0xe871c7bf077ba8b7},
+    {0x87625f056c7c4a8b, 0x11471cd764ad4972},
+    {0xa93af6c6c79b5d2d, 0xd598e40d3dd89bcf},
+    {0xd389b47879823479, 0x4aff1d108d4ec2c3},
+    {0x843610cb4bf160cb, 0xcedf722a585139ba},
+    {0xa54394fe1eedb8fe, 0xc2974eb4ee658828},
+    {0xce947a3da6a9273e, 0x733d226229feea32},
+    {0x811ccc668829b887, 0x0806357d5a3f525f},
+    {0xa163ff802a3426a8, 0xca07c2dcb0cf26f7},
+    {0xc9bcff6034c13052, 0xfc89b393dd02f0b5},
+    {0xfc2c3f3841f17c67, 0xbbac2078d443ace2},
+    {0x9d9ba7832936edc0, 0xd54b944b84aa4c0d},
+    {0xc5029163f384a931, 0x0a9e795e65d4df11},
+    {0xf64335bcf065d37d, 0x4d4617b5ff4a16d5},
+    {0x99ea0196163fa42e, 0x504bced1bf8e4e45},
+    {0xc06481fb9bcf8d39, 0xe45ec2862f71e1d6},
+    {0xf07da27a82c37088, 0x5d767327bb4e5a4c},
+    {0x964e858c91ba2655, 0x3a6a07f8d510f86f},
+    {0xbbe226efb628afea, 0x890489f70a55368b},
+    {0xeadab0aba3b2dbe5, 0x2b45ac74ccea842e},
+    {0x92c8ae6b464fc96f, 0x3b0b8bc90012929d},
+    {0xb77ada0617e3bbcb, 0x09ce6ebb40173744},
+    {0xe55990879ddcaabd, 0xcc420a6a101d0515},
+    {0x8f57fa54c2a9eab6, 0x9fa946824a12232d},
+    {0xb32df8e9f3546564, 0x47939822dc96abf9},
+    {0xdff9772470297ebd, 0x59787e2b93bc56f7},
+    {0x8bfbea76c619ef36, 0x57eb4edb3c55b65a},
+    {0xaefae51477a06b03, 0xede622920b6b23f1},
+    {0xdab99e59958885c4, 0xe95fab368e45eced},
+    {0x88b402f7fd75539b, 0x11dbcb0218ebb414},
+    {0xaae103b5fcd2a881, 0xd652bdc29f26a119},
+    {0xd59944a37c0752a2, 0x4be76d3346f0495f},
+    {0x857fcae62d8493a5, 0x6f70a4400c562ddb},
+    {0xa6dfbd9fb8e5b88e, 0xcb4ccd500f6bb952},
+    {0xd097ad07a71f26b2, 0x7e2000a41346a7a7},
+    {0x825ecc24c873782f, 0x8ed400668c0c28c8},
+    {0xa2f67f2dfa90563b, 0x728900802f0f32fa},
+    {0xcbb41ef979346bca, 0x4f2b40a03ad2ffb9},
+    {0xfea126b7d78186bc, 0xe2f610c84987bfa8},
+    {0x9f24b832e6b0f436, 0x0dd9ca7d2df4d7c9},
+    {0xc6ede63fa05d3143, 0x91503d1c79720dbb},
+    {0xf8a95fcf88747d94, 0x75a44c6397ce912a},
+    {0x9b69dbe1b548ce7c, 0xc986afbe3ee11aba},
+    {0xc24452da229b021b, 0xfbe85badce996168},
+    {0xf2d56790ab41c2a2, 0xfae27299423fb9c3},
+    {0x97c560ba6b0919a5, 0xdccd879fc967d41a},
+    {0xbdb6b8e905cb600f, 0x5400e987bbc1c920},
+    {0xed246723473e3813, 0x290123e9aab23b68},
+    {0x9436c0760c86e30b, 0xf9a0b6720aaf6521},
+    {0xb94470938fa89bce, 0xf808e40e8d5b3e69},
+    {0xe7958cb87392c2c2, 0xb60b1d1230b20e04},
+    {0x90bd77f3483bb9b9, 0xb1c6f22b5e6f48c2},
+    {0xb4ecd5f01a4aa828, 0x1e38aeb6360b1af3},
+    {0xe2280b6c20dd5232, 0x25c6da63c38de1b0},
+    {0x8d590723948a535f, 0x579c487e5a38ad0e},
+    {0xb0af48ec79ace837, 0x2d835a9df0c6d851},
+    {0xdcdb1b2798182244, 0xf8e431456cf88e65},
+    {0x8a08f0f8bf0f156b, 0x1b8e9ecb641b58ff},
+    {0xac8b2d36eed2dac5, 0xe272467e3d222f3f},
+    {0xd7adf884aa879177, 0x5b0ed81dcc6abb0f},
+    {0x86ccbb52ea94baea, 0x98e947129fc2b4e9},
+    {0xa87fea27a539e9a5, 0x3f2398d747b36224},
+    {0xd29fe4b18e88640e, 0x8eec7f0d19a03aad},
+    {0x83a3eeeef9153e89, 0x1953cf68300424ac},
+    {0xa48ceaaab75a8e2b, 0x5fa8c3423c052dd7},
+    {0xcdb02555653131b6, 0x3792f412cb06794d},
+    {0x808e17555f3ebf11, 0xe2bbd88bbee40bd0},
+    {0xa0b19d2ab70e6ed6, 0x5b6aceaeae9d0ec4},
+    {0xc8de047564d20a8b, 0xf245825a5a445275},
+    {0xfb158592be068d2e, 0xeed6e2f0f0d56712},
+    {0x9ced737bb6c4183d, 0x55464dd69685606b},
+    {0xc428d05aa4751e4c, 0xaa97e14c3c26b886},
+    {0xf53304714d9265df, 0xd53dd99f4b3066a8},
+    {0x993fe2c6d07b7fab, 0xe546a8038efe4029},
+    {0xbf8fdb78849a5f96, 0xde98520472bdd033},
+    {0xef73d256a5c0f77c, 0x963e66858f6d4440},
+    {0x95a8637627989aad, 0xdde7001379a44aa8},
+    {0xbb127c53b17ec159, 0x5560c018580d5d52},
+    {0xe9d71b689dde71af, 0xaab8f01e6e10b4a6},
+    {0x9226712162ab070d, 0xcab3961304ca70e8},
+    {0xb6b00d69bb55c8d1, 0x3d607b97c5fd0d22},
+    {0xe45c10c42a2b3b05, 0x8cb89a7db77c506a},
+    {0x8eb98a7a9a5b04e3, 0x77f3608e92adb242},
+    {0xb267ed1940f1c61c, 0x55f038b237591ed3},
+    {0xdf01e85f912e37a3, 0x6b6c46dec52f6688},
+    {0x8b61313bbabce2c6, 0x2323ac4b3b3da015},
+    {0xae397d8aa96c1b77, 0xabec975e0a0d081a},
+    {0xd9c7dced53c72255, 0x96e7bd358c904a21},
+    {0x881cea14545c7575, 0x7e50d64177da2e54},
+    {0xaa242499697392d2, 0xdde50bd1d5d0b9e9},
+    {0xd4ad2dbfc3d07787, 0x955e4ec64b44e864},
+    {0x84ec3c97da624ab4, 0xbd5af13bef0b113e},
+    {0xa6274bbdd0fadd61, 0xecb1ad8aeacdd58e},
+    {0xcfb11ead453994ba, 0x67de18eda5814af2},
+    {0x81ceb32c4b43fcf4, 0x80eacf948770ced7},
+    {0xa2425ff75e14fc31, 0xa1258379a94d028d},
+    {0xcad2f7f5359a3b3e, 0x096ee45813a04330},
+    {0xfd87b5f28300ca0d, 0x8bca9d6e188853fc},
+    {0x9e74d1b791e07e48, 0x775ea264cf55347e},
+    {0xc612062576589dda, 0x95364afe032a819e},
+    {0xf79687aed3eec551, 0x3a83ddbd83f52205},
+    {0x9abe14cd44753b52, 0xc4926a9672793543},
+    {0xc16d9a0095928a27, 0x75b7053c0f178294},
+    {0xf1c90080baf72cb1, 0x5324c68b12dd6339},
+    {0x971da05074da7bee, 0xd3f6fc16ebca5e04},
+    {0xbce5086492111aea, 0x88f4bb1ca6bcf585},
+    {0xec1e4a7db69561a5, 0x2b31e9e3d06c32e6},
+    {0x9392ee8e921d5d07, 0x3aff322e62439fd0},
+    {0xb877aa3236a4b449, 0x09befeb9fad487c3},
+    {0xe69594bec44de15b, 0x4c2ebe687989a9b4},
+    {0x901d7cf73ab0acd9, 0x0f9d37014bf60a11},
+    {0xb424dc35095cd80f, 0x538484c19ef38c95},
+    {0xe12e13424bb40e13, 0x2865a5f206b06fba},
+    {0x8cbccc096f5088cb, 0xf93f87b7442e45d4},
+    {0xafebff0bcb24aafe, 0xf78f69a51539d749},
+    {0xdbe6fecebdedd5be, 0xb573440e5a884d1c},
+    {0x89705f4136b4a597, 0x31680a88f8953031},
+    {0xabcc77118461cefc, 0xfdc20d2b36ba7c3e},
+    {0xd6bf94d5e57a42bc, 0x3d32907604691b4d},
+    {0x8637bd05af6c69b5, 0xa63f9a49c2c1b110},
+    {0xa7c5ac471b478423, 0x0fcf80dc33721d54},
+    {0xd1b71758e219652b, 0xd3c36113404ea4a9},
+    {0x83126e978d4fdf3b, 0x645a1cac083126ea},
+    {0xa3d70a3d70a3d70a, 0x3d70a3d70a3d70a4},
+    {0xcccccccccccccccc, 0xcccccccccccccccd},
+    {0x8000000000000000, 0x0000000000000000},
+    {0xa000000000000000, 0x0000000000000000},
+    {0xc800000000000000, 0x0000000000000000},
+    {0xfa00000000000000, 0x0000000000000000},
+    {0x9c40000000000000, 0x0000000000000000},
+    {0xc350000000000000, 0x0000000000000000},
+    {0xf424000000000000, 0x0000000000000000},
+    {0x9896800000000000, 0x0000000000000000},
+    {0xbebc200000000000, 0x0000000000000000},
+    {0xee6b280000000000, 0x0000000000000000},
+    {0x9502f90000000000, 0x0000000000000000},
+    {0xba43b74000000000, 0x0000000000000000},
+    {0xe8d4a51000000000, 0x0000000000000000},
+    {0x9184e72a00000000, 0x0000000000000000},
+    {0xb5e620f480000000, 0x0000000000000000},
+    {0xe35fa931a0000000, 0x0000000000000000},
+    {0x8e1bc9bf04000000, 0x0000000000000000},
+    {0xb1a2bc2ec5000000, 0x0000000000000000},
+    {0xde0b6b3a76400000, 0x0000000000000000},
+    {0x8ac7230489e80000, 0x0000000000000000},
+    {0xad78ebc5ac620000, 0x0000000000000000},
+    {0xd8d726b7177a8000, 0x0000000000000000},
+    {0x878678326eac9000, 0x0000000000000000},
+    {0xa968163f0a57b400, 0x0000000000000000},
+    {0xd3c21bcecceda100, 0x0000000000000000},
+    {0x84595161401484a0, 0x0000000000000000},
+    {0xa56fa5b99019a5c8, 0x0000000000000000},
+    {0xcecb8f27f4200f3a, 0x0000000000000000},
+    {0x813f3978f8940984, 0x4000000000000000},
+    {0xa18f07d736b90be5, 0x5000000000000000},
+    {0xc9f2c9cd04674ede, 0xa400000000000000},
+    {0xfc6f7c4045812296, 0x4d00000000000000},
+    {0x9dc5ada82b70b59d, 0xf020000000000000},
+    {0xc5371912364ce305, 0x6c28000000000000},
+    {0xf684df56c3e01bc6, 0xc732000000000000},
+    {0x9a130b963a6c115c, 0x3c7f400000000000},
+    {0xc097ce7bc90715b3, 0x4b9f100000000000},
+    {0xf0bdc21abb48db20, 0x1e86d40000000000},
+    {0x96769950b50d88f4, 0x1314448000000000},
+    {0xbc143fa4e250eb31, 0x17d955a000000000},
+    {0xeb194f8e1ae525fd, 0x5dcfab0800000000},
+    {0x92efd1b8d0cf37be, 0x5aa1cae500000000},
+    {0xb7abc627050305ad, 0xf14a3d9e40000000},
+    {0xe596b7b0c643c719, 0x6d9ccd05d0000000},
+    {0x8f7e32ce7bea5c6f, 0xe4820023a2000000},
+    {0xb35dbf821ae4f38b, 0xdda2802c8a800000},
+    {0xe0352f62a19e306e, 0xd50b2037ad200000},
+    {0x8c213d9da502de45, 0x4526f422cc340000},
+    {0xaf298d050e4395d6, 0x9670b12b7f410000},
+    {0xdaf3f04651d47b4c, 0x3c0cdd765f114000},
+    {0x88d8762bf324cd0f, 0xa5880a69fb6ac800},
+    {0xab0e93b6efee0053, 0x8eea0d047a457a00},
+    {0xd5d238a4abe98068, 0x72a4904598d6d880},
+    {0x85a36366eb71f041, 0x47a6da2b7f864750},
+    {0xa70c3c40a64e6c51, 0x999090b65f67d924},
+    {0xd0cf4b50cfe20765, 0xfff4b4e3f741cf6d},
+    {0x82818f1281ed449f, 0xbff8f10e7a8921a4},
+    {0xa321f2d7226895c7, 0xaff72d52192b6a0d},
+    {0xcbea6f8ceb02bb39, 0x9bf4f8a69f764490},
+    {0xfee50b7025c36a08, 0x02f236d04753d5b4},
+    {0x9f4f2726179a2245, 0x01d762422c946590},
+    {0xc722f0ef9d80aad6, 0x424d3ad2b7b97ef5},
+    {0xf8ebad2b84e0d58b, 0xd2e0898765a7deb2},
+    {0x9b934c3b330c8577, 0x63cc55f49f88eb2f},
+    {0xc2781f49ffcfa6d5, 0x3cbf6b71c76b25fb},
+    {0xf316271c7fc3908a, 0x8bef464e3945ef7a},
+    {0x97edd871cfda3a56, 0x97758bf0e3cbb5ac},
+    {0xbde94e8e43d0c8ec, 0x3d52eeed1cbea317},
+    {0xed63a231d4c4fb27, 0x4ca7aaa863ee4bdd},
+    {0x945e455f24fb1cf8, 0x8fe8caa93e74ef6a},
+    {0xb975d6b6ee39e436, 0xb3e2fd538e122b44},
+    {0xe7d34c64a9c85d44, 0x60dbbca87196b616},
+    {0x90e40fbeea1d3a4a, 0xbc8955e946fe31cd},
+    {0xb51d13aea4a488dd, 0x6babab6398bdbe41},
+    {0xe264589a4dcdab14, 0xc696963c7eed2dd1},
+    {0x8d7eb76070a08aec, 0xfc1e1de5cf543ca2},
+    {0xb0de65388cc8ada8, 0x3b25a55f43294bcb},
+    {0xdd15fe86affad912, 0x49ef0eb713f39ebe},
+    {0x8a2dbf142dfcc7ab, 0x6e3569326c784337},
+    {0xacb92ed9397bf996, 0x49c2c37f07965404},
+    {0xd7e77a8f87daf7fb, 0xdc33745ec97be906},
+    {0x86f0ac99b4e8dafd, 0x69a028bb3ded71a3},
+    {0xa8acd7c0222311bc, 0xc40832ea0d68ce0c},
+    {0xd2d80db02aabd62b, 0xf50a3fa490c30190},
+    {0x83c7088e1aab65db, 0x792667c6da79e0fa},
+    {0xa4b8cab1a1563f52, 0x577001b891185938},
+    {0xcde6fd5e09abcf26, 0xed4c0226b55e6f86},
+    {0x80b05e5ac60b6178, 0x544f8158315b05b4},
+    {0xa0dc75f1778e39d6, 0x696361ae3db1c721},
+    {0xc913936dd571c84c, 0x03bc3a19cd1e38e9},
+    {0xfb5878494ace3a5f, 0x04ab48a04065c723},
+    {0x9d174b2dcec0e47b, 0x62eb0d64283f9c76},
+    {0xc45d1df942711d9a, 0x3ba5d0bd324f8394},
+    {0xf5746577930d6500, 0xca8f44ec7ee36479},
+    {0x9968bf6abbe85f20, 0x7e998b13cf4e1ecb},
+    {0xbfc2ef456ae276e8, 0x9e3fedd8c321a67e},
+    {0xefb3ab16c59b14a2, 0xc5cfe94ef3ea101e},
+    {0x95d04aee3b80ece5, 0xbba1f1d158724a12},
+    {0xbb445da9ca61281f, 0x2a8a6e45ae8edc97},
+    {0xea1575143cf97226, 0xf52d09d71a3293bd},
+    {0x924d692ca61be758, 0x593c2626705f9c56},
+    {0xb6e0c377cfa2e12e, 0x6f8b2fb00c77836c},
+    {0xe498f455c38b997a, 0x0b6dfb9c0f956447},
+    {0x8edf98b59a373fec, 0x4724bd4189bd5eac},
+    {0xb2977ee300c50fe7, 0x58edec91ec2cb657},
+    {0xdf3d5e9bc0f653e1, 0x2f2967b66737e3ed},
+    {0x8b865b215899f46c, 0xbd79e0d20082ee74},
+    {0xae67f1e9aec07187, 0xecd8590680a3aa11},
+    {0xda01ee641a708de9, 0xe80e6f4820cc9495},
+    {0x884134fe908658b2, 0x3109058d147fdcdd},
+    {0xaa51823e34a7eede, 0xbd4b46f0599fd415},
+    {0xd4e5e2cdc1d1ea96, 0x6c9e18ac7007c91a},
+    {0x850fadc09923329e, 0x03e2cf6bc604ddb0},
+    {0xa6539930bf6bff45, 0x84db8346b786151c},
+    {0xcfe87f7cef46ff16, 0xe612641865679a63},
+    {0x81f14fae158c5f6e, 0x4fcb7e8f3f60c07e},
+    {0xa26da3999aef7749, 0xe3be5e330f38f09d},
+    {0xcb090c8001ab551c, 0x5cadf5bfd3072cc5},
+    {0xfdcb4fa002162a63, 0x73d9732fc7c8f7f6},
+    {0x9e9f11c4014dda7e, 0x2867e7fddcdd9afa},
+    {0xc646d63501a1511d, 0xb281e1fd541501b8},
+    {0xf7d88bc24209a565, 0x1f225a7ca91a4226},
+    {0x9ae757596946075f, 0x3375788de9b06958},
+    {0xc1a12d2fc3978937, 0x0052d6b1641c83ae},
+    {0xf209787bb47d6b84, 0xc0678c5dbd23a49a},
+    {0x9745eb4d50ce6332, 0xf840b7ba963646e0},
+    {0xbd176620a501fbff, 0xb650e5a93bc3d898},
+    {0xec5d3fa8ce427aff, 0xa3e51f138ab4cebe},
+    {0x93ba47c980e98cdf, 0xc66f336c36b10137},
+    {0xb8a8d9bbe123f017, 0xb80b0047445d4184},
+    {0xe6d3102ad96cec1d, 0xa60dc059157491e5},
+    {0x9043ea1ac7e41392, 0x87c89837ad68db2f},
+    {0xb454e4a179dd1877, 0x29babe4598c311fb},
+    {0xe16a1dc9d8545e94, 0xf4296dd6fef3d67a},
+    {0x8ce2529e2734bb1d, 0x1899e4a65f58660c},
+    {0xb01ae745b101e9e4, 0x5ec05dcff72e7f8f},
+    {0xdc21a1171d42645d, 0x76707543f4fa1f73},
+    {0x899504ae72497eba, 0x6a06494a791c53a8},
+    {0xabfa45da0edbde69, 0x0487db9d17636892},
+    {0xd6f8d7509292d603, 0x45a9d2845d3c42b6},
+    {0x865b86925b9bc5c2, 0x0b8a2392ba45a9b2},
+    {0xa7f26836f282b732, 0x8e6cac7768d7141e},
+    {0xd1ef0244af2364ff, 0x3207d795430cd926},
+    {0x8335616aed761f1f, 0x7f44e6bd49e807b8},
+    {0xa402b9c5a8d3a6e7, 0x5f16206c9c6209a6},
+    {0xcd036837130890a1, 0x36dba887c37a8c0f},
+    {0x802221226be55a64, 0xc2494954da2c9789},
+    {0xa02aa96b06deb0fd, 0xf2db9baa10b7bd6c},
+    {0xc83553c5c8965d3d, 0x6f92829494e5acc7},
+    {0xfa42a8b73abbf48c, 0xcb772339ba1f17f9},
+    {0x9c69a97284b578d7, 0xff2a760414536efb},
+    {0xc38413cf25e2d70d, 0xfef5138519684aba},
+    {0xf46518c2ef5b8cd1, 0x7eb258665fc25d69},
+    {0x98bf2f79d5993802, 0xef2f773ffbd97a61},
+    {0xbeeefb584aff8603, 0xaafb550ffacfd8fa},
+    {0xeeaaba2e5dbf6784, 0x95ba2a53f983cf38},
+    {0x952ab45cfa97a0b2, 0xdd945a747bf26183},
+    {0xba756174393d88df, 0x94f971119aeef9e4},
+    {0xe912b9d1478ceb17, 0x7a37cd5601aab85d},
+    {0x91abb422ccb812ee, 0xac62e055c10ab33a},
+    {0xb616a12b7fe617aa, 0x577b986b314d6009},
+    {0xe39c49765fdf9d94, 0xed5a7e85fda0b80b},
+    {0x8e41ade9fbebc27d, 0x14588f13be847307},
+    {0xb1d219647ae6b31c, 0x596eb2d8ae258fc8},
+    {0xde469fbd99a05fe3, 0x6fca5f8ed9aef3bb},
+    {0x8aec23d680043bee, 0x25de7bb9480d5854},
+    {0xada72ccc20054ae9, 0xaf561aa79a10ae6a},
+    {0xd910f7ff28069da4, 0x1b2ba1518094da04},
+    {0x87aa9aff79042286, 0x90fb44d2f05d0842},
+    {0xa99541bf57452b28, 0x353a1607ac744a53},
+    {0xd3fa922f2d1675f2, 0x42889b8997915ce8},
+    {0x847c9b5d7c2e09b7, 0x69956135febada11},
+    {0xa59bc234db398c25, 0x43fab9837e699095},
+    {0xcf02b2c21207ef2e, 0x94f967e45e03f4bb},
+    {0x8161afb94b44f57d, 0x1d1be0eebac278f5},
+    {0xa1ba1ba79e1632dc, 0x6462d92a69731732},
+    {0xca28a291859bbf93, 0x7d7b8f7503cfdcfe},
+    {0xfcb2cb35e702af78, 0x5cda735244c3d43e},
+    {0x9defbf01b061adab, 0x3a0888136afa64a7},
+    {0xc56baec21c7a1916, 0x088aaa1845b8fdd0},
+    {0xf6c69a72a3989f5b, 0x8aad549e57273d45},
+    {0x9a3c2087a63f6399, 0x36ac54e2f678864b},
+    {0xc0cb28a98fcf3c7f, 0x84576a1bb416a7dd},
+    {0xf0fdf2d3f3c30b9f, 0x656d44a2a11c51d5},
+    {0x969eb7c47859e743, 0x9f644ae5a4b1b325},
+    {0xbc4665b596706114, 0x873d5d9f0dde1fee},
+    {0xeb57ff22fc0c7959, 0xa90cb506d155a7ea},
+    {0x9316ff75dd87cbd8, 0x09a7f12442d588f2},
+    {0xb7dcbf5354e9bece, 0x0c11ed6d538aeb2f},
+    {0xe5d3ef282a242e81, 0x8f1668c8a86da5fa},
+    {0x8fa475791a569d10, 0xf96e017d694487bc},
+    {0xb38d92d760ec4455, 0x37c981dcc395a9ac},
+    {0xe070f78d3927556a, 0x85bbe253f47b1417},
+    {0x8c469ab843b89562, 0x93956d7478ccec8e},
+    {0xaf58416654a6babb, 0x387ac8d1970027b2},
+    {0xdb2e51bfe9d0696a, 0x06997b05fcc0319e},
+    {0x88fcf317f22241e2, 0x441fece3bdf81f03},
+    {0xab3c2fddeeaad25a, 0xd527e81cad7626c3},
+    {0xd60b3bd56a5586f1, 0x8a71e223d8d3b074},
+    {0x85c7056562757456, 0xf6872d5667844e49},
+    {0xa738c6bebb12d16c, 0xb428f8ac016561db},
+    {0xd106f86e69d785c7, 0xe13336d701beba52},
+    {0x82a45b450226b39c, 0xecc0024661173473},
+    {0xa34d721642b06084, 0x27f002d7f95d0190},
+    {0xcc20ce9bd35c78a5, 0x31ec038df7b441f4},
+    {0xff290242c83396ce, 0x7e67047175a15271},
+    {0x9f79a169bd203e41, 0x0f0062c6e984d386},
+    {0xc75809c42c684dd1, 0x52c07b78a3e60868},
+    {0xf92e0c3537826145, 0xa7709a56ccdf8a82},
+    {0x9bbcc7a142b17ccb, 0x88a66076400bb691},
+    {0xc2abf989935ddbfe, 0x6acff893d00ea435},
+    {0xf356f7ebf83552fe, 0x0583f6b8c4124d43},
+    {0x98165af37b2153de, 0xc3727a337a8b704a},
+    {0xbe1bf1b059e9a8d6, 0x744f18c0592e4c5c},
+    {0xeda2ee1c7064130c, 0x1162def06f79df73},
+    {0x9485d4d1c63e8be7, 0x8addcb5645ac2ba8},
+    {0xb9a74a0637ce2ee1, 0x6d953e2bd7173692},
+    {0xe8111c87c5c1ba99, 0xc8fa8db6ccdd0437},
+    {0x910ab1d4db9914a0, 0x1d9c9892400a22a2},
+    {0xb54d5e4a127f59c8, 0x2503beb6d00cab4b},
+    {0xe2a0b5dc971f303a, 0x2e44ae64840fd61d},
+    {0x8da471a9de737e24, 0x5ceaecfed289e5d2},
+    {0xb10d8e1456105dad, 0x7425a83e872c5f47},
+    {0xdd50f1996b947518, 0xd12f124e28f77719},
+    {0x8a5296ffe33cc92f, 0x82bd6b70d99aaa6f},
+    {0xace73cbfdc0bfb7b, 0x636cc64d1001550b},
+    {0xd8210befd30efa5a, 0x3c47f7e05401aa4e},
+    {0x8714a775e3e95c78, 0x65acfaec34810a71},
+    {0xa8d9d1535ce3b396, 0x7f1839a741a14d0d},
+    {0xd31045a8341ca07c, 0x1ede48111209a050},
+    {0x83ea2b892091e44d, 0x934aed0aab460432},
+    {0xa4e4b66b68b65d60, 0xf81da84d5617853f},
+    {0xce1de40642e3f4b9, 0x36251260ab9d668e},
+    {0x80d2ae83e9ce78f3, 0xc1d72b7c6b426019},
+    {0xa1075a24e4421730, 0xb24cf65b8612f81f},
+    {0xc94930ae1d529cfc, 0xdee033f26797b627},
+    {0xfb9b7cd9a4a7443c, 0x169840ef017da3b1},
+    {0x9d412e0806e88aa5, 0x8e1f289560ee864e},
+    {0xc491798a08a2ad4e, 0xf1a6f2bab92a27e2},
+    {0xf5b5d7ec8acb58a2, 0xae10af696774b1db},
+    {0x9991a6f3d6bf1765, 0xacca6da1e0a8ef29},
+    {0xbff610b0cc6edd3f, 0x17fd090a58d32af3},
+    {0xeff394dcff8a948e, 0xddfc4b4cef07f5b0},
+    {0x95f83d0a1fb69cd9, 0x4abdaf101564f98e},
+    {0xbb764c4ca7a4440f, 0x9d6d1ad41abe37f1},
+    {0xea53df5fd18d5513, 0x84c86189216dc5ed},
+    {0x92746b9be2f8552c, 0x32fd3cf5b4e49bb4},
+    {0xb7118682dbb66a77, 0x3fbc8c33221dc2a1},
+    {0xe4d5e82392a40515, 0x0fabaf3feaa5334a},
+    {0x8f05b1163ba6832d, 0x29cb4d87f2a7400e},
+    {0xb2c71d5bca9023f8, 0x743e20e9ef511012},
+    {0xdf78e4b2bd342cf6, 0x914da9246b255416},
+    {0x8bab8eefb6409c1a, 0x1ad089b6c2f7548e},
+    {0xae9672aba3d0c320, 0xa184ac2473b529b1},
+    {0xda3c0f568cc4f3e8, 0xc9e5d72d90a2741e},
+    {0x8865899617fb1871, 0x7e2fa67c7a658892},
+    {0xaa7eebfb9df9de8d, 0xddbb901b98feeab7},
+    {0xd51ea6fa85785631, 0x552a74227f3ea565},
+    {0x8533285c936b35de, 0xd53a88958f87275f},
+    {0xa67ff273b8460356, 0x8a892abaf368f137},
+    {0xd01fef10a657842c, 0x2d2b7569b0432d85},
+    {0x8213f56a67f6b29b, 0x9c3b29620e29fc73},
+    {0xa298f2c501f45f42, 0x8349f3ba91b47b8f},
+    {0xcb3f2f7642717713, 0x241c70a936219a73},
+    {0xfe0efb53d30dd4d7, 0xed238cd383aa0110},
+    {0x9ec95d1463e8a506, 0xf4363804324a40aa},
+    {0xc67bb4597ce2ce48, 0xb143c6053edcd0d5},
+    {0xf81aa16fdc1b81da, 0xdd94b7868e94050a},
+    {0x9b10a4e5e9913128, 0xca7cf2b4191c8326},
+    {0xc1d4ce1f63f57d72, 0xfd1c2f611f63a3f0},
+    {0xf24a01a73cf2dccf, 0xbc633b39673c8cec},
+    {0x976e41088617ca01, 0xd5be0503e085d813},
+    {0xbd49d14aa79dbc82, 0x4b2d8644d8a74e18},
+    {0xec9c459d51852ba2, 0xddf8e7d60ed1219e},
+    {0x93e1ab8252f33b45, 0xcabb90e5c942b503},
+    {0xb8da1662e7b00a17, 0x3d6a751f3b936243},
+    {0xe7109bfba19c0c9d, 0x0cc512670a783ad4},
+    {0x906a617d450187e2, 0x27fb2b80668b24c5},
+    {0xb484f9dc9641e9da, 0xb1f9f660802dedf6},
+    {0xe1a63853bbd26451, 0x5e7873f8a0396973},
+    {0x8d07e33455637eb2, 0xdb0b487b6423e1e8},
+    {0xb049dc016abc5e5f, 0x91ce1a9a3d2cda62},
+    {0xdc5c5301c56b75f7, 0x7641a140cc7810fb},
+    {0x89b9b3e11b6329ba, 0xa9e904c87fcb0a9d},
+    {0xac2820d9623bf429, 0x546345fa9fbdcd44},
+    {0xd732290fbacaf133, 0xa97c177947ad4095},
+    {0x867f59a9d4bed6c0, 0x49ed8eabcccc485d},
+    {0xa81f301449ee8c70, 0x5c68f256bfff5a74},
+    {0xd226fc195c6a2f8c, 0x73832eec6fff3111},
+    {0x83585d8fd9c25db7, 0xc831fd53c5ff7eab},
+    {0xa42e74f3d032f525, 0xba3e7ca8b77f5e55},
+    {0xcd3a1230c43fb26f, 0x28ce1bd2e55f35eb},
+    {0x80444b5e7aa7cf85, 0x7980d163cf5b81b3},
+    {0xa0555e361951c366, 0xd7e105bcc332621f},
+    {0xc86ab5c39fa63440, 0x8dd9472bf3fefaa7},
+    {0xfa856334878fc150, 0xb14f98f6f0feb951},
+    {0x9c935e00d4b9d8d2, 0x6ed1bf9a569f33d3},
+    {0xc3b8358109e84f07, 0x0a862f80ec4700c8},
+    {0xf4a642e14c6262c8, 0xcd27bb612758c0fa},
+    {0x98e7e9cccfbd7dbd, 0x8038d51cb897789c},
+    {0xbf21e44003acdd2c, 0xe0470a63e6bd56c3},
+    {0xeeea5d5004981478, 0x1858ccfce06cac74},
+    {0x95527a5202df0ccb, 0x0f37801e0c43ebc8},
+    {0xbaa718e68396cffd, 0xd30560258f54e6ba},
+    {0xe950df20247c83fd, 0x47c6b82ef32a2069},
+    {0x91d28b7416cdd27e, 0x4cdc331d57fa5441},
+    {0xb6472e511c81471d, 0xe0133fe4adf8e952},
+    {0xe3d8f9e563a198e5, 0x58180fddd97723a6},
+    {0x8e679c2f5e44ff8f, 0x570f09eaa7ea7648}
+};
 
 
 #endif